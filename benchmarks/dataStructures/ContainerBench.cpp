@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include "dataStructures/LinkedCellsContainer.h"
+#include "model/LennardJonesModel.h"
+#include "utils/ArrayUtils.h"
+#include "utils/BenchUtils.h"
+
+namespace {
+/// The containers whose force calculation gets benchmarked
+const std::vector<ContainerType> pairContainers{
+    ContainerType::VECTOR,
+    ContainerType::LINKED_CELLS,
+    ContainerType::LINKED_CELLS_LOCKS,
+    ContainerType::LINKED_CELLS_COLOURING_SINGLE,
+    ContainerType::LINKED_CELLS_COLOURING_MULTIPLE,
+    ContainerType::LINKED_CELLS_SOA,
+    ContainerType::LINKED_CELLS_VERLET,
+    ContainerType::LINKED_CELLS_FORCE_BUFFER,
+    ContainerType::LINKED_CELLS_FORCE_BUFFER_BLOCKED,
+};
+
+/// The particle densities in particles per 100 units of volume, from a dilute gas to a dense liquid
+const std::vector<int> densities{10, 40, 80};
+
+/**
+ * Registers every container with every density, the parallel containers additionally with every thread count
+ */
+void pairArguments(benchmark::internal::Benchmark *benchmark) {
+  benchmark->ArgNames({"container", "density", "threads"});
+  for (auto type : pairContainers) {
+    for (int density : densities) {
+      auto threadCounts = BenchUtils::isParallel(type) ? BenchUtils::threadCounts() : std::vector<int>{1};
+      for (int threads : threadCounts) benchmark->Args({static_cast<int>(type), density, threads});
+    }
+  }
+}
+
+/**
+ * Registers the parallel containers with a dense droplet in an empty domain and every thread count
+ */
+void dropletArguments(benchmark::internal::Benchmark *benchmark) {
+  benchmark->ArgNames({"container", "density", "threads"});
+  for (auto type : pairContainers) {
+    if (!BenchUtils::isParallel(type)) continue;
+    for (int threads : BenchUtils::threadCounts()) benchmark->Args({static_cast<int>(type), 80, threads});
+  }
+}
+
+/**
+ * Registers the sequential and the parallel structure update with and without sorting the particles by cell
+ */
+void structureArguments(benchmark::internal::Benchmark *benchmark) {
+  benchmark->ArgNames({"container", "density", "sortInterval", "threads"});
+  for (auto type : {ContainerType::LINKED_CELLS, ContainerType::LINKED_CELLS_FORCE_BUFFER}) {
+    for (int density : densities) {
+      for (int sortInterval : {0, 1}) {
+        auto threadCounts = BenchUtils::isParallel(type) ? BenchUtils::threadCounts() : std::vector<int>{1};
+        for (int threads : threadCounts) benchmark->Args({static_cast<int>(type), density, sortInterval, threads});
+      }
+    }
+  }
+}
+}  // namespace
+
+/**
+ * One Lennard-Jones force calculation via applyForceModel, which is the path the simulation takes for every container
+ * without a model specialization. It includes the structure update, the boundaries and the container specific kernels.
+ */
+static void BM_ForEachPair(benchmark::State &state) {
+  auto type = static_cast<ContainerType>(state.range(0));
+  BenchUtils::setThreadCount(static_cast<int>(state.range(2)));
+
+  auto container = BenchUtils::makeContainer(type);
+  BenchUtils::fillWithDensity(*container, static_cast<double>(state.range(1)) / 100.);
+
+  LennardJonesModel model{BenchUtils::cutOffRadius};
+  using P = Particle &;
+  std::function<void(P, P)> addForces{
+      [&model](P p1, P p2) { model.addForces(std::forward<P>(p1), std::forward<P>(p2)); }};
+
+  for (auto _ : state) {
+    container->applyForceModel(model, addForces);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetLabel(BenchUtils::containerName(type));
+  state.counters["particles"] = static_cast<double>(container->size());
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(container->size()));
+}
+BENCHMARK(BM_ForEachPair)->Apply(pairArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Like BM_ForEachPair, but all particles are within a droplet in the center of the domain, so that the cost of the
+ * cells varies strongly and the parallel containers have to balance it
+ */
+static void BM_ForEachPairDroplet(benchmark::State &state) {
+  auto type = static_cast<ContainerType>(state.range(0));
+  BenchUtils::setThreadCount(static_cast<int>(state.range(2)));
+
+  auto container = BenchUtils::makeContainer(type);
+  BenchUtils::fillWithDroplet(*container, static_cast<double>(state.range(1)) / 100.);
+
+  LennardJonesModel model{BenchUtils::cutOffRadius};
+  using P = Particle &;
+  std::function<void(P, P)> addForces{
+      [&model](P p1, P p2) { model.addForces(std::forward<P>(p1), std::forward<P>(p2)); }};
+
+  for (auto _ : state) {
+    container->applyForceModel(model, addForces);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetLabel(BenchUtils::containerName(type));
+  state.counters["particles"] = static_cast<double>(container->size());
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(container->size()));
+}
+BENCHMARK(BM_ForEachPairDroplet)->Apply(dropletArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Sorting the particles into their cells after every particle moved by a fraction of the cell size, so that some of
+ * them change their cell. Moving the particles is not measured.
+ */
+static void BM_RecalculateStructure(benchmark::State &state) {
+  auto type = static_cast<ContainerType>(state.range(0));
+  BenchUtils::setThreadCount(static_cast<int>(state.range(3)));
+
+  auto container = BenchUtils::makeContainer(type);
+  BenchUtils::fillWithDensity(*container, static_cast<double>(state.range(1)) / 100.);
+  auto &linkedCells = dynamic_cast<LinkedCellsContainer &>(*container);
+  linkedCells.setSortInterval(static_cast<unsigned>(state.range(2)));
+  linkedCells.recalculateStructure();
+
+  // Moving back and forth keeps the particles within the domain
+  double step = 0.2;
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (auto &particle : linkedCells.getParticlesRef()) particle.setX(particle.getX() + std::array{step, step, step});
+    step = -step;
+    state.ResumeTiming();
+
+    linkedCells.recalculateStructure();
+    benchmark::ClobberMemory();
+  }
+
+  state.SetLabel(BenchUtils::containerName(type));
+  state.counters["particles"] = static_cast<double>(container->size());
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(container->size()));
+}
+BENCHMARK(BM_RecalculateStructure)->Apply(structureArguments)->Unit(benchmark::kMicrosecond)->UseRealTime();
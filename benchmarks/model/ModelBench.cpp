@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "model/LennardJonesModel.h"
+#include "model/SmoothedLennardJonesModel.h"
+#include "utils/BenchUtils.h"
+
+namespace {
+/// The number of particles the pair kernels cycle through, small enough to stay in the L1 cache
+constexpr size_t pairParticleCount = 512;
+
+/**
+ * Makes particles at random positions within a cube a little wider than the cut off radius, so that most but not all
+ * of the pairs of consecutive particles interact
+ * @return The particles
+ */
+std::vector<Particle> makePairParticles() {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> position{0., 1.2 * BenchUtils::cutOffRadius};
+  std::vector<Particle> particles;
+  particles.reserve(pairParticleCount);
+  for (size_t i = 0; i < pairParticleCount; ++i) {
+    particles.emplace_back(std::array{position(generator), position(generator), position(generator)},
+                           std::array{0., 0., 0.}, 1., 0);
+  }
+  return particles;
+}
+
+/**
+ * Calls addForces of the model for all pairs of consecutive particles
+ * @tparam Model The concrete type of the model, so that addForces can be inlined like in the specialized pair loops
+ */
+template <typename Model>
+void benchmarkAddForces(benchmark::State &state, const Model &model) {
+  auto particles = makePairParticles();
+  for (auto _ : state) {
+    for (size_t i = 0; i + 1 < particles.size(); ++i) model.Model::addForces(particles[i], particles[i + 1]);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(particles.size() - 1));
+}
+}  // namespace
+
+static void BM_LennardJonesAddForces(benchmark::State &state) {
+  benchmarkAddForces(state, LennardJonesModel{BenchUtils::cutOffRadius});
+}
+BENCHMARK(BM_LennardJonesAddForces);
+
+static void BM_SmoothedLennardJonesAddForces(benchmark::State &state) {
+  benchmarkAddForces(state, SmoothedLennardJonesModel{BenchUtils::cutOffRadius, 0.8 * BenchUtils::cutOffRadius});
+}
+BENCHMARK(BM_SmoothedLennardJonesAddForces);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+#include "dataStructures/VectorContainer.h"
+#include "outputWriter/AsyncWriter.h"
+#include "outputWriter/CheckpointFileWriter.h"
+#include "outputWriter/StatisticsWriter.h"
+#include "outputWriter/VTKWriter.h"
+#include "outputWriter/XYZWriter.h"
+#include "utils/BenchUtils.h"
+
+namespace {
+/**
+ * @param name The name of the output file
+ * @return The path of the file within the temporary directory of the benchmarks
+ */
+std::string outputPath(const std::string &name) {
+  auto directory = std::filesystem::temp_directory_path() / "MolSimBench";
+  std::filesystem::create_directories(directory);
+  return (directory / name).string();
+}
+
+/**
+ * Writes the particles with the writer in every iteration, the same file gets overwritten
+ * @param writer The writer that gets benchmarked
+ * @param name The name of the output file
+ */
+void benchmarkWriter(benchmark::State &state, IWriter &writer, const std::string &name) {
+  VectorContainer container{};
+  BenchUtils::fillWithDensity(container, static_cast<double>(state.range(0)) / 100.);
+  auto path = outputPath(name);
+
+  for (auto _ : state) writer.writeFile(path, 0, container);
+  writer.flush();
+
+  state.counters["particles"] = static_cast<double>(container.size());
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(container.size()));
+}
+
+/**
+ * Registers the particle densities, which result in 800 and 6400 particles
+ */
+void writerArguments(benchmark::internal::Benchmark *benchmark) {
+  benchmark->ArgName("density")->Arg(10)->Arg(80)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+}  // namespace
+
+static void BM_VTKWriter(benchmark::State &state) {
+  VTKWriter writer{};
+  benchmarkWriter(state, writer, "bench");
+}
+BENCHMARK(BM_VTKWriter)->Apply(writerArguments);
+
+static void BM_XYZWriter(benchmark::State &state) {
+  XYZWriter writer{};
+  benchmarkWriter(state, writer, "bench");
+}
+BENCHMARK(BM_XYZWriter)->Apply(writerArguments);
+
+static void BM_CheckpointTextWriter(benchmark::State &state) {
+  CheckpointFileWriter writer{outputPath("checkpoint.txt")};
+  benchmarkWriter(state, writer, "checkpoint.txt");
+}
+BENCHMARK(BM_CheckpointTextWriter)->Apply(writerArguments);
+
+static void BM_CheckpointBinaryWriter(benchmark::State &state) {
+  CheckpointFileWriter writer{outputPath("checkpoint.bin")};
+  benchmarkWriter(state, writer, "checkpoint.bin");
+}
+BENCHMARK(BM_CheckpointBinaryWriter)->Apply(writerArguments);
+
+/**
+ * Only the time the simulation thread spends in writeFile, the vtk files are written on the background thread. Once
+ * the queue is full this converges to the throughput of the VTKWriter.
+ */
+static void BM_AsyncVTKWriter(benchmark::State &state) {
+  AsyncWriter writer{std::make_unique<VTKWriter>()};
+  benchmarkWriter(state, writer, "bench_async");
+}
+BENCHMARK(BM_AsyncVTKWriter)->Apply(writerArguments);
+
+/**
+ * The statistics appended every iteration, including the radial distribution function
+ */
+static void BM_StatisticsWriter(benchmark::State &state) {
+  VectorContainer container{};
+  BenchUtils::fillWithDensity(container, static_cast<double>(state.range(0)) / 100.);
+  auto path = outputPath("statistics.csv");
+  StatisticsWriter writer{container, 1, path, 0.1, 0., BenchUtils::cutOffRadius};
+
+  int iteration = 1;
+  for (auto _ : state) writer.writeFile(path, iteration++, container);
+
+  state.counters["particles"] = static_cast<double>(container.size());
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(container.size()));
+}
+BENCHMARK(BM_StatisticsWriter)->Apply(writerArguments);
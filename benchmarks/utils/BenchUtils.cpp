@@ -0,0 +1,158 @@
+#include "BenchUtils.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "dataStructures/BarnesHutContainer.h"
+#include "dataStructures/LinkedCellsContainerSoA.h"
+#include "dataStructures/LinkedCellsContainerVerlet.h"
+#include "dataStructures/VectorContainer.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringMultiple.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerForceBuffer.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerLocks.h"
+
+std::unique_ptr<IContainer> BenchUtils::makeContainer(ContainerType type) {
+  if (type == ContainerType::VECTOR) return std::make_unique<VectorContainer>();
+  if (type == ContainerType::BARNES_HUT) return std::make_unique<BarnesHutContainer>();
+
+  // 7 cells per dimension, so that a cell is wider than cutOffRadius + verletSkin
+  double cellSize = domainSize / 7;
+  std::array<double, 3> left{0., 0., 0.};
+  std::array<double, 3> right{domainSize, domainSize, domainSize};
+
+  std::unique_ptr<LinkedCellsContainer> container;
+  switch (type) {
+    case ContainerType::LINKED_CELLS:
+      container = std::make_unique<LinkedCellsContainer>(cellSize, left, right);
+      break;
+    case ContainerType::LINKED_CELLS_LOCKS:
+      container = std::make_unique<LinkedCellsContainerLocks>(cellSize, left, right);
+      break;
+    case ContainerType::LINKED_CELLS_COLOURING_SINGLE:
+      container = std::make_unique<LinkedCellsContainerColouringSingle>(cellSize, left, right);
+      break;
+    case ContainerType::LINKED_CELLS_COLOURING_MULTIPLE:
+      container = std::make_unique<LinkedCellsContainerColouringMultiple>(cellSize, left, right);
+      break;
+    case ContainerType::LINKED_CELLS_SOA:
+      container = std::make_unique<LinkedCellsContainerSoA>(cellSize, left, right);
+      break;
+    case ContainerType::LINKED_CELLS_VERLET:
+      container = std::make_unique<LinkedCellsContainerVerlet>(cellSize, left, right, cutOffRadius, verletSkin);
+      break;
+    case ContainerType::LINKED_CELLS_FORCE_BUFFER:
+      container = std::make_unique<LinkedCellsContainerForceBuffer>(cellSize, left, right, ForceBufferReduction::Full);
+      break;
+    case ContainerType::LINKED_CELLS_FORCE_BUFFER_BLOCKED:
+      container =
+          std::make_unique<LinkedCellsContainerForceBuffer>(cellSize, left, right, ForceBufferReduction::Blocked);
+      break;
+    default:
+      throw std::runtime_error("Make function for ContainerType not implemented. Check BenchUtils.cpp.");
+  }
+
+  container->setBoundaries({
+      {CubeSide::LEFT, BoundaryType::PERIODIC},
+      {CubeSide::RIGHT, BoundaryType::PERIODIC},
+      {CubeSide::TOP, BoundaryType::PERIODIC},
+      {CubeSide::BOTTOM, BoundaryType::PERIODIC},
+      {CubeSide::FRONT, BoundaryType::PERIODIC},
+      {CubeSide::BACK, BoundaryType::PERIODIC},
+  });
+  return container;
+}
+
+std::string BenchUtils::containerName(ContainerType type) {
+  switch (type) {
+    case ContainerType::VECTOR:
+      return "Vector";
+    case ContainerType::LINKED_CELLS:
+      return "LinkedCells";
+    case ContainerType::LINKED_CELLS_LOCKS:
+      return "Locks";
+    case ContainerType::LINKED_CELLS_COLOURING_SINGLE:
+      return "ColouringSingle";
+    case ContainerType::LINKED_CELLS_COLOURING_MULTIPLE:
+      return "ColouringMultiple";
+    case ContainerType::LINKED_CELLS_SOA:
+      return "SoA";
+    case ContainerType::LINKED_CELLS_VERLET:
+      return "Verlet";
+    case ContainerType::LINKED_CELLS_FORCE_BUFFER:
+      return "ForceBuffer";
+    case ContainerType::LINKED_CELLS_FORCE_BUFFER_BLOCKED:
+      return "ForceBufferBlocked";
+    case ContainerType::BARNES_HUT:
+      return "BarnesHut";
+  }
+  return "Unknown";
+}
+
+bool BenchUtils::isParallel(ContainerType type) {
+  return type == ContainerType::LINKED_CELLS_LOCKS || type == ContainerType::LINKED_CELLS_COLOURING_SINGLE ||
+         type == ContainerType::LINKED_CELLS_COLOURING_MULTIPLE || type == ContainerType::LINKED_CELLS_FORCE_BUFFER ||
+         type == ContainerType::LINKED_CELLS_FORCE_BUFFER_BLOCKED || type == ContainerType::BARNES_HUT;
+}
+
+void BenchUtils::fillWithDensity(IContainer &container, double density) {
+  double spacing = std::cbrt(1. / density);
+  auto perDimension = static_cast<size_t>(domainSize / spacing);
+
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> jitter{-0.05 * spacing, 0.05 * spacing};
+
+  container.reserve(perDimension * perDimension * perDimension);
+  for (size_t i = 0; i < perDimension; ++i) {
+    for (size_t j = 0; j < perDimension; ++j) {
+      for (size_t k = 0; k < perDimension; ++k) {
+        std::array<double, 3> x{(i + 0.5) * spacing + jitter(generator), (j + 0.5) * spacing + jitter(generator),
+                                (k + 0.5) * spacing + jitter(generator)};
+        container.emplace_back(x, {0., 0., 0.}, 1., 0);
+      }
+    }
+  }
+}
+
+void BenchUtils::fillWithDroplet(IContainer &container, double density) {
+  double spacing = std::cbrt(1. / density);
+  auto perDimension = static_cast<size_t>(domainSize / spacing);
+  double radiusSquared = (domainSize / 4) * (domainSize / 4);
+
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> jitter{-0.05 * spacing, 0.05 * spacing};
+
+  for (size_t i = 0; i < perDimension; ++i) {
+    for (size_t j = 0; j < perDimension; ++j) {
+      for (size_t k = 0; k < perDimension; ++k) {
+        std::array<double, 3> x{(i + 0.5) * spacing + jitter(generator), (j + 0.5) * spacing + jitter(generator),
+                                (k + 0.5) * spacing + jitter(generator)};
+        double distanceSquared = 0.;
+        for (int d = 0; d < 3; ++d) distanceSquared += (x[d] - domainSize / 2) * (x[d] - domainSize / 2);
+        if (distanceSquared < radiusSquared) container.emplace_back(x, {0., 0., 0.}, 1., 0);
+      }
+    }
+  }
+}
+
+std::vector<int> BenchUtils::threadCounts() {
+#ifdef _OPENMP
+  int maxThreads = omp_get_max_threads();
+#else
+  int maxThreads = 1;
+#endif
+  std::vector<int> counts;
+  for (int threads = 1; threads < maxThreads; threads *= 2) counts.push_back(threads);
+  counts.push_back(maxThreads);
+  return counts;
+}
+
+void BenchUtils::setThreadCount(int threads) {
+#ifdef _OPENMP
+  omp_set_num_threads(threads);
+#endif
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dataStructures/IContainer.h"
+#include "utils/MolSimEnums.h"
+
+namespace BenchUtils {
+
+/// The edge length of the cubic domain of the container benchmarks
+constexpr double domainSize = 20.;
+
+/// The cut off radius of the Lennard-Jones benchmarks
+constexpr double cutOffRadius = 2.5;
+
+/// The skin of the Verlet neighbor lists, the cells are at least cutOffRadius + verletSkin wide
+constexpr double verletSkin = 0.3;
+
+/**
+ * Makes a container of the given type spanning the benchmark domain with periodic boundaries on all sides
+ * @param type The type of the container
+ * @return The container
+ */
+std::unique_ptr<IContainer> makeContainer(ContainerType type);
+
+/**
+ * @param type The type of a container
+ * @return The name of the container type used in the benchmark labels
+ */
+std::string containerName(ContainerType type);
+
+/**
+ * @param type The type of a container
+ * @return Whether the force calculation of the container uses multiple threads
+ */
+bool isParallel(ContainerType type);
+
+/**
+ * Fills the container with resting particles of mass 1 and type 0 on a slightly jittered cubic lattice within the
+ * benchmark domain. The jitter is seeded, so that every run benchmarks the same positions.
+ * @param container The container that gets filled
+ * @param density The number of particles per unit volume
+ */
+void fillWithDensity(IContainer &container, double density);
+
+/**
+ * Fills the container like fillWithDensity, but only within a sphere of a quarter of the domain size around the center
+ * of the domain. The rest of the domain stays empty, so that a few cells hold all particle pairs.
+ * @param container The container that gets filled
+ * @param density The number of particles per unit volume within the droplet
+ */
+void fillWithDroplet(IContainer &container, double density);
+
+/**
+ * @return The thread counts the parallel benchmarks run with: 1, 2, 4, ... up to the maximal number of threads
+ */
+std::vector<int> threadCounts();
+
+/**
+ * Sets the number of threads of the following parallel regions, if OpenMP is enabled
+ * @param threads The number of threads
+ */
+void setThreadCount(int threads);
+
+}  // end namespace BenchUtils
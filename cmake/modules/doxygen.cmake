@@ -20,9 +20,7 @@ IF (BUILD_DOC)
         # Set parameters for Doxygen-file
         set(DOXYGEN_INPUT "../src \
                 ../README.md")
-        set(DOXYGEN_EXCLUDE "../src/outputWriter/vtk-unstructured.cpp \
-                ../src/outputWriter/vtk-unstructured.h \
-                ../src/outputWriter/vtk-unstructured.xsd")
+        set(DOXYGEN_EXCLUDE "")
         set(DOXYGEN_MAIN_PAGE ../README.md)
 
         set(DOXYGEN_IMAGES "../images/runtime.png \
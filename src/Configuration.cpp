@@ -93,6 +93,9 @@ Configuration Configuration::parseOptions(int argc, char *argsv[]) {
                                          {"delta-t", required_argument, nullptr, 'd'},
                                          {"write-frequency", required_argument, nullptr, 'w'},
                                          {"performance", no_argument, nullptr, 'p'},
+                                         {"timers-json", required_argument, nullptr, 'm'},
+                                         {"trace", required_argument, nullptr, 'k'},
+                                         {"trace-interval", required_argument, nullptr, 'K'},
                                          {"hit-rate", no_argument, nullptr, 'r'},
                                          {"verbose", no_argument, nullptr, 'v'},
                                          {"quiet", no_argument, nullptr, 'q'},
@@ -104,7 +107,7 @@ Configuration Configuration::parseOptions(int argc, char *argsv[]) {
 
   // Define behavior
   int opt{0};
-  while ((opt = getopt_long(argc, argsv, "s:ci:o:njgt:f:e:d:w:prvqh", long_options, nullptr)) != -1) {
+  while ((opt = getopt_long(argc, argsv, "s:ci:o:njgt:f:e:d:w:pm:k:K:rvqh", long_options, nullptr)) != -1) {
     switch (opt) {
       case 'o': {
         config.outFileName = optarg;
@@ -167,6 +170,22 @@ Configuration Configuration::parseOptions(int argc, char *argsv[]) {
         config.performanceMeasure = true;
         break;
       }
+      case 'm': {
+        config.timersJsonPath = optarg;
+        break;
+      }
+      case 'k': {
+        config.tracePath = optarg;
+        break;
+      }
+      case 'K': {
+        config.traceInterval = std::atoi(optarg);
+        if (config.traceInterval <= 0) {
+          spdlog::error("The trace interval has to be a positive integer, but is {}. Please check --help.", optarg);
+          exit(EXIT_FAILURE);
+        }
+        break;
+      }
       case 'r': {
         config.hitRateMeasure = true;
         break;
@@ -221,6 +240,7 @@ bool Configuration::tryParseXml() {
   outputWriteInterval = xmlParser->getWriteInterval();
   cutOff = xmlParser->getCutOffRadius();
   radius_l = xmlParser->getRadius_l();
+  fusedIntegration = xmlParser->getFusedIntegration();
   containerType = xmlParser->getContainerType();
   outFileName = xmlParser->extractSimulation().getFilename();
 
@@ -230,7 +250,11 @@ bool Configuration::tryParseXml() {
 
   xmlParser->initializeParticleTypes();
   fromCheckpointPath = xmlParser->getCheckpointPath();
-  container = std::make_unique<LinkedCellArg>(xmlParser->extractLinkedCell());
+  if (containerType == ContainerType::BARNES_HUT) {
+    barnesHutTheta = xmlParser->extractBarnesHutTheta();
+  } else if (containerType != ContainerType::VECTOR) {
+    container = std::make_unique<LinkedCellArg>(xmlParser->extractLinkedCell());
+  }
   thermostat = std::make_unique<ThermostatArg>(xmlParser->getThermostat());
 
   StatArg statArg = xmlParser->extractStatistics();
@@ -245,13 +269,15 @@ bool Configuration::tryParseXml() {
 
 void Configuration::printUsage() {
   std::cout << " Usage\n"
-               "        ./MolSim -i <input-file> [-n] [-p] [-r] [-s] [-c] [-j] [-g] [-v] [-v] [-q] [-x]\n"
+               "        ./MolSim -i <input-file> [-n] [-p] [-m <filepath>] [-k <filepath>] [-K <iteration-count>] [-r] "
+               "[-s] [-c] [-j] [-g] [-v] [-v] [-q] [-x]\n"
                "\n"
                " Usage (deprecated)\n"
                "        ./MolSim -f <input-file> [-t (single|cuboid|sphere)] [-o "
                "<output-file>] [-e <endtime>]\n"
                "                                [-d <deltaT>] [-w <iteration-count>] "
-               "[-n] [-p] [-r] [-s] [-c] [-j] [-g] [-v] [-v] [-q] [-x]\n"
+               "[-n] [-p] [-m <filepath>] [-k <filepath>] [-K <iteration-count>]\n"
+               "                                [-r] [-s] [-c] [-j] [-g] [-v] [-v] [-q] [-x]\n"
                "\n"
                "For more information run ./Molsim -h or ./Molsim --help"
             << std::endl;
@@ -262,7 +288,8 @@ void Configuration::printHelp() {
                "        ./MolSim -f <input-file> [-t (single|cuboid|sphere)] [-o "
                "<output-file>] [-e <endtime>]\n"
                "                                [-d <deltaT>] [-w <iteration-count>] "
-               "[-n] [-j] [-p] [-r] [-v] [-v] [-q]\n"
+               "[-n] [-j] [-p] [-m <filepath>] [-k <filepath>]\n"
+               "                                [-K <iteration-count>] [-r] [-v] [-v] [-q]\n"
                "\n"
                "OPTIONS:\n"
                "        -i <filepath>, --xml=<filepath>\n"
@@ -320,6 +347,20 @@ void Configuration::printHelp() {
                "                Takes a performance measurement of the simulation, \n"
                "                implicitly sets the -n flag and deactivates logging "
                "entirely.\n"
+               "                Also prints the time spent in each phase of an iteration and, for the \n"
+               "                parallel containers, the load imbalance between the threads.\n"
+               "                \n"
+               "        -m <filepath>, --timers-json=<filepath>\n"
+               "                Measures the time spent in each phase of an iteration and writes \n"
+               "                it as JSON to <filepath>, including the time of each thread.\n"
+               "                \n"
+               "        -k <filepath>, --trace=<filepath>\n"
+               "                Records the phases of sampled iterations on each thread, including \n"
+               "                every colour pass, and writes them as Chrome Trace Event JSON to \n"
+               "                <filepath>. Open it with chrome://tracing or ui.perfetto.dev.\n"
+               "                \n"
+               "        -K <iteration-count>, --trace-interval=<iteration-count>\n"
+               "                Every <iteration-count>nth iteration is traced (default is 100).\n"
                "                \n"
                "        -r, --hit-rate\n"
                "               Measures the hit-rate of the pairwise force "
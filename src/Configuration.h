@@ -82,12 +82,18 @@ class Configuration {
   /// The radius for the SmoothedLennardJones Model
   double radius_l{4.0};
 
+  /// Whether the integration steps are fused with each other and the force calculation
+  bool fusedIntegration{false};
+
   /// The type of the container where particles are stored (e.g. vector or linked cells)
   ContainerType containerType{ContainerType::LINKED_CELLS};
 
   /// The container itself
   std::unique_ptr<LinkedCellArg> container;
 
+  /// The opening angle of the Barnes-Hut container
+  double barnesHutTheta{0.5};
+
   /// The thermostat of the container
   std::unique_ptr<ThermostatArg> thermostat;
 
@@ -95,6 +101,15 @@ class Configuration {
   /// Enable performance logging
   bool performanceMeasure{false};
 
+  /// Path of the JSON file the phase timers are written to, empty if they are not written
+  std::string timersJsonPath;
+
+  /// Path of the Chrome trace of the phases, empty if no trace is recorded
+  std::string tracePath;
+
+  /// Every traceInterval-th iteration is recorded in the trace
+  int traceInterval{100};
+
   /// Enable hitrate measuring
   bool hitRateMeasure{false};
 
@@ -160,6 +175,8 @@ class Configuration {
   [[nodiscard]] bool hasRegisterStatistics() const { return registerStatistics; }
   [[nodiscard]] bool hasPerformanceMeasureEnabled() const { return performanceMeasure; };
   [[nodiscard]] bool hasHitrateMeasureEnabled() const { return hitRateMeasure; };
+  [[nodiscard]] bool hasPhaseTimersEnabled() const { return performanceMeasure || !timersJsonPath.empty(); };
+  [[nodiscard]] bool hasTraceEnabled() const { return !tracePath.empty(); };
 
   // Simulation getters
   [[nodiscard]] double getGravityConst() const { return gravityConstant; };
@@ -168,6 +185,7 @@ class Configuration {
   [[nodiscard]] double getWriteInterval() const { return outputWriteInterval; };
   [[nodiscard]] double getCutOff() const { return cutOff; }
   [[nodiscard]] double getRadiusL() const { return radius_l; }
+  [[nodiscard]] bool getFusedIntegration() const { return fusedIntegration; }
   [[nodiscard]] ModelType getSelectedModel() const {
     return getInputType() != InputType::XML ? ModelType::LennardJones : xmlParser->getModel();
   }
@@ -176,6 +194,7 @@ class Configuration {
   [[nodiscard]] std::vector<ParticleShape> getParticleShapes() { return particleShapes; }
 
   [[nodiscard]] LinkedCellArg* getContainerSpecs() { return container.get(); };
+  [[nodiscard]] double getBarnesHutTheta() const { return barnesHutTheta; }
   [[nodiscard]] ThermostatArg* getThermostat() { return thermostat.get(); };
 
   // Input
@@ -183,6 +202,9 @@ class Configuration {
   [[nodiscard]] InputType getInputType() const { return inputType; };
   [[nodiscard]] std::string getFromCheckpointPath() const { return fromCheckpointPath; };
   [[nodiscard]] std::string getToCheckpointPath() const { return toCheckpointPath; };
+  [[nodiscard]] std::string getTimersJsonPath() const { return timersJsonPath; };
+  [[nodiscard]] std::string getTracePath() const { return tracePath; };
+  [[nodiscard]] int getTraceInterval() const { return traceInterval; };
   [[nodiscard]] std::string getStatFile() const { return statFile; }
   [[nodiscard]] int getStatFrequency() const { return statFrequency; }
   [[nodiscard]] double getRdfDeltaR() const { return rdfDeltaR; }
@@ -7,7 +7,9 @@
 #include "outputWriter/StatisticsWriter.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog/spdlog.h"
+#include "utils/PhaseTimers.h"
 #include "utils/SimulationUtils.h"
+#include "utils/TraceRecorder.h"
 
 // --------------------------------------
 //                 Main
@@ -29,7 +31,8 @@ int main(int argc, char* argsv[]) {
   // 2. Set up container and populate it with particles
   std::unique_ptr<IContainer> container;
   if (isXmlInput) {
-    container = SimulationUtils::makeContainer(config.getContainerType(), config.getContainerSpecs());
+    container = SimulationUtils::makeContainer(config.getContainerType(), config.getContainerSpecs(),
+                                               config.getCutOff(), config.getBarnesHutTheta());
   } else {
     container = SimulationUtils::makeDefaultContainer();
   }
@@ -52,6 +55,7 @@ int main(int argc, char* argsv[]) {
   auto checkpointWriter = CheckpointFileWriter(config.getToCheckpointPath());
   auto statisticsWriter = StatisticsWriter(*container, config.getStatFrequency(), config.getStatFile(),
                                            config.getRdfDeltaR(), config.getRdfStart(), config.getRdfEnd());
+  if (config.hasRegisterStatistics()) statisticsWriter.enablePairObservation(config.getCutOff());
 
   // 4. Start simulation
   Simulation simulation{};
@@ -59,10 +63,13 @@ int main(int argc, char* argsv[]) {
   simulation.setEndTime(config.getEndTime());
   simulation.setIterationsPerWrite(config.getWriteInterval());
   simulation.setFilename(config.getFileName());
+  simulation.setFusedIntegration(config.getFusedIntegration());
 
   spdlog::info("Simulation is starting with {} particles and will run for {} iterations.", container->size(),
                std::ceil(config.getEndTime() / config.getDeltaT()));
 
+  if (config.hasPhaseTimersEnabled()) PhaseTimers::enable();
+  if (config.hasTraceEnabled()) TraceRecorder::enable(config.getTraceInterval());
   auto startTime = std::chrono::steady_clock::now();
 
   simulation.simulate(*model, *container, *writer, *thermostat, config.getGravityConst(), config.getGasSimulation(),
@@ -74,6 +81,11 @@ int main(int argc, char* argsv[]) {
   // 5. Print performance stats
   if (config.hasPerformanceMeasureEnabled())
     ConfigurationUtils::printPerformanceMeasure(startTime, endTime, simulation);
+  if (config.hasPhaseTimersEnabled())
+    ConfigurationUtils::printPhaseTimers(startTime, endTime, config.hasPerformanceMeasureEnabled(),
+                                         config.getTimersJsonPath());
+  if (config.hasPerformanceMeasureEnabled()) ConfigurationUtils::printLoadImbalance(*container);
+  if (config.hasTraceEnabled()) ConfigurationUtils::writeTrace(config.getTracePath());
   if (config.hasHitrateMeasureEnabled()) ConfigurationUtils::printHitrateMeasure(std::move(model));
 
   spdlog::info("Your simulation is completed. Terminating.");
@@ -3,11 +3,76 @@
 //
 #include "Simulation.h"
 
+#include <typeinfo>
+
+#include "dataStructures/LinkedCellsContainer.h"
+#include "dataStructures/VectorContainer.h"
+#include "model/LennardJonesModel.h"
+#include "model/SmoothedLennardJonesModel.h"
 #include "outputWriter/CheckpointFileWriter.h"
 #include "outputWriter/StatisticsWriter.h"
 #include "spdlog/spdlog.h"
+#include "utils/PhaseTimers.h"
 #define PROGRESS_MSG_COUNT 15
 
+namespace {
+/**
+ * Replaces the force calculation by one that is specialized for the concrete model and container type, if both types
+ * match exactly. The pair loop then calls the model directly, so its force calculation can be inlined.
+ * @tparam Model The model type to specialize for
+ * @param model The model of the simulation
+ * @param particles The container of the simulation
+ * @param calculateForces The force calculation, which gets replaced on success
+ * @param finalizeFunction If not null, it gets applied onto each particle once its forces are known. Only supported by
+ * the linked cells container.
+ * @return True if the force calculation was specialized
+ */
+template <typename Model>
+bool specializeForceCalculation(IModel &model, IContainer &particles, std::function<void()> &calculateForces,
+                                std::function<void(Particle &)> *finalizeFunction = nullptr) {
+  if (typeid(model) != typeid(Model) || particles.containsStructures()) return false;
+  auto &concreteModel = static_cast<Model &>(model);
+
+  if (typeid(particles) == typeid(LinkedCellsContainer)) {
+    auto &container = static_cast<LinkedCellsContainer &>(particles);
+    if (finalizeFunction) {
+      calculateForces = [&container, &concreteModel, finalizeFunction]() {
+        container.forEachPairWithModel(concreteModel, *finalizeFunction);
+      };
+    } else {
+      calculateForces = [&container, &concreteModel]() { container.forEachPairWithModel(concreteModel); };
+    }
+    return true;
+  }
+
+  if (finalizeFunction) return false;
+
+  if (typeid(particles) == typeid(VectorContainer)) {
+    auto &container = static_cast<VectorContainer &>(particles);
+    calculateForces = [&container, &concreteModel]() { container.forEachPairWithModel(concreteModel); };
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Applies the force of a particle pair. Pairs within the same structure get the force of the structure, all other
+ * pairs the force of the model.
+ * @param particles The container of the simulation
+ * @param p1 The first particle
+ * @param p2 The second particle
+ * @param modelForces Applies the force of the model onto the pair
+ */
+template <typename ModelForces>
+inline void applyPairForces(IContainer &particles, Particle &p1, Particle &p2, ModelForces &&modelForces) {
+  if (p1.isInStructure() && (p1.getStructure() == p2.getStructure()))
+    particles.getStructureVectorRef()[p1.getStructure()].applyForce(p1, p2);
+  else
+    modelForces(p1, p2);
+}
+}  // namespace
+
 void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWriter, Thermostat& thermostat,
                           double gravitationalConstant, bool gasSimulation, bool checkpointing, bool statistics,
                           CheckpointFileWriter& cpfWriter, StatisticsWriter& statWriter) {
@@ -22,9 +87,11 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
 
   // Pass methods of model as lambdas. More lightweight than std::function.
   using P = Particle&;
-  std::function<void(P)> updateX{[&model, &updateCount](P p) {
+  // The updates only touch the particle they get passed, so they can be applied in parallel. The position updates
+  // return 1 per particle, so that summing them up counts the updated particles within the same pass.
+  std::function<double(P)> updateX{[&model](P p) {
     model.updateX(std::forward<P>(p));
-    ++updateCount;
+    return 1.;
   }};
   std::function<void(P)> updateV{[&model](P p) { model.updateV(std::forward<P>(p)); }};
 
@@ -32,7 +99,9 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
   double avgVelocityPrevious{0};
   double avgVelocityCurrent{0};
   double criticalSpeed{3000 * deltaT};
-  if (gasSimulation && particles.isDense()) {
+  // The velocity smoothing sums up the velocities of all particles, so it has to be applied serially
+  bool smoothVelocities = gasSimulation && particles.isDense();
+  if (smoothVelocities) {
     updateV = [&model, &avgVelocityCurrent, &avgVelocityPrevious, criticalSpeed](P p) {
       model.updateV(std::forward<P>(p));
 
@@ -58,18 +127,82 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
 
   std::function<void(P, P)> addForces{
       [&model](P p1, P p2) { model.addForces(std::forward<P>(p1), std::forward<P>(p2)); }};
-  std::function<void(P p)> registerLastPosition{[](Particle& p) { p.lastPosition = p.getX(); }};
+  std::function<void(P p)> registerLastPosition{
+      [&particles](Particle& p) { particles.getHistory(p).lastPosition = p.getX(); }};
 
   // Enable structure physics handling on demand
   if (particles.containsStructures()) {
     addForces = [&model, &particles](P p1, P p2) {
-      if (p1.isInStructure() && (p1.getStructure() == p2.getStructure()))
-        particles.getStructureVectorRef()[p1.getStructure()].applyForce(p1, p2);
-      else
-        model.addForces(std::forward<P>(p1), std::forward<P>(p2));
+      applyPairForces(particles, p1, p2, [&model](P first, P second) { model.addForces(first, second); });
+    };
+  }
+
+  // Select the force calculation once. Known model and container combinations get a pair loop that is compiled for
+  // the concrete model, everything else goes through std::function and the virtual model.
+  std::function<void()> calculateForces{[&model, &particles, &addForces]() {
+    particles.applyForceModel(model, addForces);
+  }};
+  bool isSpecialized = specializeForceCalculation<LennardJonesModel>(model, particles, calculateForces) ||
+                       specializeForceCalculation<SmoothedLennardJonesModel>(model, particles, calculateForces) ||
+                       specializeForceCalculation<NewtonsLawModel>(model, particles, calculateForces);
+  if (!isSpecialized) spdlog::debug("No specialized force calculation for model and container, using std::function.");
+
+  // Without fused integration each update is a separate pass over the particles
+  std::function<double(P)> updateXF{[&model, &updateF](P p) {
+    model.updateX(p);
+    updateF(p);
+    return 1.;
+  }};
+  auto updateVelocities = [&particles, &updateV, smoothVelocities]() {
+    ScopedPhaseTimer timer{Phase::VelocityUpdate};
+    if (smoothVelocities)
+      particles.forEach(updateV);
+    else
+      particles.forEachParallel(updateV);
+  };
+  std::function<void()> calculateForcesAndUpdateV{[&calculateForces, &updateVelocities]() {
+    calculateForces();
+    updateVelocities();
+  }};
+
+  // The linked cells container updates the velocities of each cell right after its last pair, while the particles are
+  // still in the cache
+  if (fusedIntegration && typeid(particles) == typeid(LinkedCellsContainer)) {
+    auto& container = static_cast<LinkedCellsContainer&>(particles);
+    calculateForcesAndUpdateV = [&container, &addForces, &updateV]() {
+      container.forEachPairAndFinalize(addForces, updateV);
     };
+    isSpecialized =
+        specializeForceCalculation<LennardJonesModel>(model, particles, calculateForcesAndUpdateV, &updateV) ||
+        specializeForceCalculation<SmoothedLennardJonesModel>(model, particles, calculateForcesAndUpdateV, &updateV) ||
+        specializeForceCalculation<NewtonsLawModel>(model, particles, calculateForcesAndUpdateV, &updateV);
+    spdlog::debug("Fused integration enabled, the velocities are updated during the {} force calculation.",
+                  isSpecialized ? "specialized" : "std::function");
   }
 
+  // On statistics iterations the models accumulate the potential energy and virial and the statistics observe the
+  // pairs of the force calculation, which needs the generic pair loop. All other iterations keep the force calculation
+  // selected above.
+  IPairObserver* pairObserver = statWriter.getPairObserver();
+  PairObservablesAccumulator& observables = statWriter.getPairObservables();
+  std::function<void(P, P)> addForcesObserved{[&model, &particles, &observables, pairObserver](P p1, P p2) {
+    applyPairForces(particles, p1, p2, [&model, &observables](P first, P second) {
+      model.addForcesAndObservables(first, second, observables.local());
+    });
+
+    if (pairObserver != nullptr) pairObserver->observe(p1, p2);
+  }};
+  std::function<void()> calculateForcesObservedAndUpdateV{
+      [&particles, &addForcesObserved, &updateVelocities, &observables, pairObserver]() {
+        observables.begin();
+        if (pairObserver != nullptr) pairObserver->beginTraversal();
+        particles.forEachPair(addForcesObserved);
+        if (pairObserver != nullptr) pairObserver->endTraversal();
+        observables.end();
+
+        updateVelocities();
+      }};
+
   // Initialize the container to the temperature
   if (thermostat.getPeriodLength() != 0) thermostat.initializeTemperature();
 
@@ -77,8 +210,11 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
   if (particles.containsStructures())
     for (auto& mol : particles.getStructureVectorRef()) mol.applyArtificialForces();
 
-  particles.forEach(updateF);
-  particles.forEachPair(addForces);
+  particles.forEachParallel(updateF);
+  {
+    ScopedPhaseTimer timer{Phase::ForceCalculation};
+    calculateForces();
+  }
 
   if (statistics) {
     particles.forEach(registerLastPosition);
@@ -86,16 +222,31 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
 
   // for this loop, we assume: current x, current f and current v are known
   while (current_time < endTime) {
-    particles.forEach(updateX);
-    particles.forEach(updateF);
-    particles.forEachPair(addForces);
-    particles.forEach(updateV);
+    TraceRecorder::beginIteration(iteration);
+    {
+      ScopedPhaseTimer timer{Phase::Integration};
+      if (fusedIntegration) {
+        updateCount += static_cast<size_t>(particles.reduceSum(updateXF));
+      } else {
+        updateCount += static_cast<size_t>(particles.reduceSum(updateX));
+        particles.forEachParallel(updateF);
+      }
+    }
+    {
+      ScopedPhaseTimer timer{Phase::ForceCalculation};
+      if (statistics && iteration % statWriter.getFrequency() == 0 && iteration != 0)
+        calculateForcesObservedAndUpdateV();
+      else
+        calculateForcesAndUpdateV();
+    }
 
     if (thermostat.getPeriodLength() != 0 && iteration % thermostat.getPeriodLength() == 0 && iteration != 0) {
+      ScopedPhaseTimer timer{Phase::Thermostat};
       thermostat.applyThermostat();
     }
 
     if (iteration % writeOutFrequency == 0) {
+      ScopedPhaseTimer timer{Phase::Output};
       fileWriter.writeFile(filename, iteration, particles);
 
       if ((printProgressInterval == 0 || iteration % printProgressInterval == 0) && startTime < endTime)
@@ -104,6 +255,7 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
 
     // Every 1000th iteration the statistics are being written
     if (statistics && iteration % statWriter.getFrequency() == 0 && iteration != 0) {
+      ScopedPhaseTimer timer{Phase::Statistics};
       statWriter.writeFile(statWriter.getFilename(), iteration, particles);
       particles.forEach(registerLastPosition);
     }
@@ -118,6 +270,8 @@ void Simulation::simulate(IModel& model, IContainer& particles, IWriter& fileWri
     iteration++;
   }
   moleculeUpdateCount = updateCount;
+  ScopedPhaseTimer outputTimer{Phase::Output};
+  fileWriter.flush();
 
   spdlog::info("Completed {} iterations. (100.0%)", iteration);
   if (checkpointing) {
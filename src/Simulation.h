@@ -58,6 +58,14 @@ class Simulation {
    */
   void setFilename(const std::string& filename) { Simulation::filename = filename; }
 
+  /**
+   * Sets whether the integration steps are fused. Then positions and forces are updated in one pass over the particles
+   * and, if the container supports it, the velocities are updated during the force calculation, as soon as all forces
+   * of a cell are known.
+   * @param fusedIntegration Whether the integration steps are fused
+   */
+  void setFusedIntegration(bool fusedIntegration) { Simulation::fusedIntegration = fusedIntegration; }
+
   /**
    * Returns the timestep by which the time gets increased in every iteration
    * @return The timestep by which the time gets increased in every iteration
@@ -80,6 +88,12 @@ class Simulation {
    */
   const std::string getFilename() const { return filename; }
 
+  /**
+   * Returns whether the integration steps are fused
+   * @return Whether the integration steps are fused
+   */
+  bool getFusedIntegration() const { return fusedIntegration; }
+
   /**
    * Returns the total position updates of all particles
    * @return the total position updates of all particles
@@ -110,6 +124,11 @@ class Simulation {
    */
   std::string filename = "MD_vtk";
 
+  /**
+   * Whether the integration steps are fused (default false)
+   */
+  bool fusedIntegration = false;
+
   /**
    * Counts the total position updates of all particles
    */
@@ -0,0 +1,303 @@
+#include "BarnesHutContainer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <typeinfo>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "model/NewtonsLawModel.h"
+#include "utils/PhaseTimers.h"
+
+namespace {
+/// Subtrees with more particles are built in parallel tasks, if they are close enough to the root
+constexpr std::uint32_t parallelBuildThreshold = 4096;
+
+/**
+ * Spreads the lower 21 bits of a value, so that there are two zero bits between each of them
+ * @param value The value to spread
+ * @return The spread value
+ */
+std::uint64_t spreadBits(std::uint64_t value) {
+  value &= 0x1fffff;
+  value = (value | value << 32) & 0x1f00000000ffff;
+  value = (value | value << 16) & 0x1f0000ff0000ff;
+  value = (value | value << 8) & 0x100f00f00f00f00f;
+  value = (value | value << 4) & 0x10c30c30c30c30c3;
+  value = (value | value << 2) & 0x1249249249249249;
+  return value;
+}
+}  // namespace
+
+BarnesHutContainer::BarnesHutContainer(double theta, size_t leafSize)
+    : theta{theta}, thetaSquared{theta * theta}, leafSize{leafSize} {
+  if (theta < 0) throw std::invalid_argument("The opening angle of the Barnes-Hut container must not be negative.");
+  if (leafSize == 0) throw std::invalid_argument("The leaf size of the Barnes-Hut container must be at least 1.");
+}
+
+void BarnesHutContainer::applyForceModel(IModel &model, std::function<void(Particle &, Particle &)> &binaryFunction) {
+  if (typeid(model) != typeid(NewtonsLawModel) || containsStructures()) {
+    forEachPair(binaryFunction);
+    return;
+  }
+
+  ScopedPhaseTimer buildTimer{Phase::Rebinning};
+  buildTree();
+  buildTimer.stop();
+
+  ScopedPhaseTimer traversalTimer{Phase::PairLoop};
+  auto &particles = getParticlesRef();
+  size_t count = order.size();
+  // Every sorted particle belongs to exactly one particle, so the forces can be applied without synchronization
+#pragma omp parallel for default(none) shared(particles, count) schedule(dynamic, 64)
+  for (size_t k = 0; k < count; ++k) {
+    particles[order[k]].applyForce(calculateTreeForce(static_cast<std::uint32_t>(k)));
+  }
+}
+
+void BarnesHutContainer::calculateMortonCodes() {
+  auto &particles = getParticlesRef();
+  if (particles.size() > std::numeric_limits<std::uint32_t>::max())
+    throw std::runtime_error("The Barnes-Hut container supports at most 2^32 - 1 particles.");
+
+  order.clear();
+  for (size_t i = 0; i < particles.size(); ++i) {
+    if (!particles[i].isDeleted()) order.push_back(static_cast<std::uint32_t>(i));
+  }
+  size_t count = order.size();
+  codes.resize(count);
+  if (count == 0) return;
+
+  double minX{std::numeric_limits<double>::max()}, minY{minX}, minZ{minX};
+  double maxX{std::numeric_limits<double>::lowest()}, maxY{maxX}, maxZ{maxX};
+#pragma omp parallel for default(none) shared(particles, count) reduction(min : minX, minY, minZ) \
+    reduction(max : maxX, maxY, maxZ) schedule(static)
+  for (size_t k = 0; k < count; ++k) {
+    auto &position = particles[order[k]].getX();
+    minX = std::min(minX, position[0]);
+    minY = std::min(minY, position[1]);
+    minZ = std::min(minZ, position[2]);
+    maxX = std::max(maxX, position[0]);
+    maxY = std::max(maxY, position[1]);
+    maxZ = std::max(maxZ, position[2]);
+  }
+
+  rootSize = std::max({maxX - minX, maxY - minY, maxZ - minZ});
+  if (rootSize <= 0) rootSize = 1.;
+
+  // The particles on the upper faces of the root cube are clamped into the last cell
+  const std::array<double, 3> origin{minX, minY, minZ};
+  const std::uint64_t maxCell = (std::uint64_t{1} << mortonBits) - 1;
+  const double scale = static_cast<double>(std::uint64_t{1} << mortonBits) / rootSize;
+#pragma omp parallel for default(none) shared(particles, count, origin, maxCell, scale) schedule(static)
+  for (size_t k = 0; k < count; ++k) {
+    auto &position = particles[order[k]].getX();
+    std::uint64_t code = 0;
+    for (int d = 0; d < 3; ++d) {
+      auto cell = std::min(static_cast<std::uint64_t>((position[d] - origin[d]) * scale), maxCell);
+      code |= spreadBits(cell) << (2 - d);
+    }
+    codes[k] = code;
+  }
+}
+
+void BarnesHutContainer::sortByMortonCode() {
+  constexpr int digitBits = 8;
+  constexpr size_t digitCount = size_t{1} << digitBits;
+
+  size_t count = codes.size();
+  codesBuffer.resize(count);
+  orderBuffer.resize(count);
+
+#ifdef _OPENMP
+  std::vector<std::array<size_t, digitCount>> offsets(omp_get_max_threads());
+#else
+  std::vector<std::array<size_t, digitCount>> offsets(1);
+#endif
+
+  // Each pass sorts stably by one digit. Every thread counts the digits of one contiguous chunk, the counts are scanned
+  // in the order digit, thread by one thread and then every thread scatters its chunk.
+  for (int shift = 0; shift < 3 * mortonBits; shift += digitBits) {
+#pragma omp parallel default(none) shared(count, shift, offsets)
+    {
+#ifdef _OPENMP
+      size_t threadCount = omp_get_num_threads();
+      size_t threadNum = omp_get_thread_num();
+#else
+      size_t threadCount = 1;
+      size_t threadNum = 0;
+#endif
+      size_t chunkBegin = count * threadNum / threadCount;
+      size_t chunkEnd = count * (threadNum + 1) / threadCount;
+
+      auto &histogram = offsets[threadNum];
+      histogram.fill(0);
+      for (size_t k = chunkBegin; k < chunkEnd; ++k) ++histogram[(codes[k] >> shift) & (digitCount - 1)];
+
+#pragma omp barrier
+#pragma omp single
+      {
+        size_t sum = 0;
+        for (size_t digit = 0; digit < digitCount; ++digit) {
+          for (size_t t = 0; t < threadCount; ++t) {
+            size_t digitTotal = offsets[t][digit];
+            offsets[t][digit] = sum;
+            sum += digitTotal;
+          }
+        }
+      }
+
+      for (size_t k = chunkBegin; k < chunkEnd; ++k) {
+        size_t target = histogram[(codes[k] >> shift) & (digitCount - 1)]++;
+        codesBuffer[target] = codes[k];
+        orderBuffer[target] = order[k];
+      }
+    }
+
+    codes.swap(codesBuffer);
+    order.swap(orderBuffer);
+  }
+}
+
+void BarnesHutContainer::buildSubtree(std::vector<Node> &out, std::uint32_t begin, std::uint32_t end, int level) {
+  size_t index = out.size();
+  out.emplace_back();
+
+  Node node{};
+  node.begin = begin;
+  node.end = end;
+  double size = std::ldexp(rootSize, -level);
+  node.sizeSquared = size * size;
+
+  if (end - begin <= leafSize || level == mortonBits) {
+    node.leaf = true;
+    for (std::uint32_t k = begin; k < end; ++k) {
+      node.mass += m[k];
+      node.centerOfMass[0] += m[k] * x[k];
+      node.centerOfMass[1] += m[k] * y[k];
+      node.centerOfMass[2] += m[k] * z[k];
+    }
+  } else {
+    // The codes within the node share all bits above the octant of this level, so the octants are sorted
+    int shift = 3 * (mortonBits - 1 - level);
+    std::array<std::uint32_t, 9> bounds{};
+    bounds[0] = begin;
+    for (std::uint32_t octant = 0; octant < 8; ++octant) {
+      auto first = codes.begin() + bounds[octant];
+      auto last = codes.begin() + end;
+      auto split = std::partition_point(first, last, [shift, octant](std::uint64_t code) {
+        return ((code >> shift) & 7) <= octant;
+      });
+      bounds[octant + 1] = static_cast<std::uint32_t>(split - codes.begin());
+    }
+
+    if (level < parallelBuildDepth && end - begin > parallelBuildThreshold) {
+      std::array<std::vector<Node>, 8> children;
+      for (std::uint32_t octant = 0; octant < 8; ++octant) {
+        if (bounds[octant] == bounds[octant + 1]) continue;
+#pragma omp task default(shared) firstprivate(octant)
+        buildSubtree(children[octant], bounds[octant], bounds[octant + 1], level + 1);
+      }
+#pragma omp taskwait
+
+      for (auto &child : children) {
+        auto offset = static_cast<std::uint32_t>(out.size());
+        for (auto &childNode : child) {
+          childNode.skip += offset;
+          out.push_back(childNode);
+        }
+      }
+    } else {
+      for (std::uint32_t octant = 0; octant < 8; ++octant) {
+        if (bounds[octant] != bounds[octant + 1]) buildSubtree(out, bounds[octant], bounds[octant + 1], level + 1);
+      }
+    }
+
+    for (size_t child = index + 1; child < out.size(); child = out[child].skip) {
+      node.mass += out[child].mass;
+      for (int d = 0; d < 3; ++d) node.centerOfMass[d] += out[child].mass * out[child].centerOfMass[d];
+    }
+  }
+
+  if (node.mass > 0) {
+    for (int d = 0; d < 3; ++d) node.centerOfMass[d] /= node.mass;
+  }
+  node.skip = static_cast<std::uint32_t>(out.size());
+  out[index] = node;
+}
+
+void BarnesHutContainer::buildTree() {
+  calculateMortonCodes();
+  sortByMortonCode();
+
+  auto &particles = getParticlesRef();
+  size_t count = order.size();
+  x.resize(count);
+  y.resize(count);
+  z.resize(count);
+  m.resize(count);
+#pragma omp parallel for default(none) shared(particles, count) schedule(static)
+  for (size_t k = 0; k < count; ++k) {
+    auto &particle = particles[order[k]];
+    x[k] = particle.getX()[0];
+    y[k] = particle.getX()[1];
+    z[k] = particle.getX()[2];
+    m[k] = particle.getM();
+  }
+
+  nodes.clear();
+  if (count == 0) return;
+
+#pragma omp parallel default(none) shared(count)
+#pragma omp single
+  buildSubtree(nodes, 0, static_cast<std::uint32_t>(count), 0);
+}
+
+std::array<double, 3> BarnesHutContainer::calculateTreeForce(std::uint32_t k) const {
+  double fx = 0., fy = 0., fz = 0.;
+  const double xk = x[k], yk = y[k], zk = z[k];
+
+  size_t i = 0;
+  while (i < nodes.size()) {
+    const Node &node = nodes[i];
+
+    // A node containing the particle itself is always opened
+    if (k < node.begin || k >= node.end) {
+      double dx = node.centerOfMass[0] - xk;
+      double dy = node.centerOfMass[1] - yk;
+      double dz = node.centerOfMass[2] - zk;
+      double lengthSqr = dx * dx + dy * dy + dz * dz;
+      if (node.sizeSquared < thetaSquared * lengthSqr) {
+        double scalar = node.mass / (lengthSqr * std::sqrt(lengthSqr));
+        fx += scalar * dx;
+        fy += scalar * dy;
+        fz += scalar * dz;
+        i = node.skip;
+        continue;
+      }
+    }
+
+    if (!node.leaf) {
+      ++i;
+      continue;
+    }
+
+    for (std::uint32_t j = node.begin; j < node.end; ++j) {
+      if (j == k) continue;
+      double dx = x[j] - xk;
+      double dy = y[j] - yk;
+      double dz = z[j] - zk;
+      double lengthSqr = dx * dx + dy * dy + dz * dz;
+      double scalar = m[j] / (lengthSqr * std::sqrt(lengthSqr));
+      fx += scalar * dx;
+      fy += scalar * dy;
+      fz += scalar * dz;
+    }
+    i = node.skip;
+  }
+
+  return {m[k] * fx, m[k] * fy, m[k] * fz};
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+
+#include "VectorContainer.h"
+
+/**
+ * Container for gravitational simulations with the NewtonsLawModel. Every force calculation builds an octree over the
+ * particles and the force upon each particle is calculated by traversing the tree: nodes that appear small enough
+ * from the particle, i.e. edge length / distance to their center of mass < theta, are approximated by their total mass
+ * at the center of mass, all others are opened. This reduces the force calculation from O(N²) to O(N log N).
+ * The tree is built from the particles sorted by the Morton code of their position, so every node covers a contiguous
+ * range of the sorted particles. Other models, structures and the statistics iterations use the direct sum of the
+ * VectorContainer.
+ * @note theta = 0 opens every node and equals the direct sum
+ */
+class BarnesHutContainer : public VectorContainer {
+ private:
+  /// A node of the octree, stored in pre-order so that the first child of a node directly follows it
+  struct Node {
+    std::array<double, 3> centerOfMass;
+    double mass;
+
+    /// The squared edge length of the cube covered by the node
+    double sizeSquared;
+
+    /// The index of the next node after the subtree of this node
+    std::uint32_t skip;
+
+    /// The range of the sorted particles within the node
+    std::uint32_t begin;
+    std::uint32_t end;
+
+    /// Whether the particles of the node are stored directly instead of in children
+    bool leaf;
+  };
+
+  /// Bits of the Morton code per dimension, which is also the maximal depth of the tree
+  static constexpr int mortonBits = 21;
+
+  /// Nodes up to this depth build their children in parallel tasks
+  static constexpr int parallelBuildDepth = 2;
+
+  /// The opening angle
+  double theta;
+
+  /// theta², a node is approximated if its squared edge length is less than theta² * squared distance
+  double thetaSquared;
+
+  /// The maximal number of particles in a leaf
+  size_t leafSize;
+
+  /// The nodes of the last built tree in pre-order, the root is the first node
+  std::vector<Node> nodes;
+
+  /// The Morton codes of the sorted particles
+  std::vector<std::uint64_t> codes;
+
+  /// The indices of the sorted particles within the particles vector
+  std::vector<std::uint32_t> order;
+
+  /// Buffers of the radix sort
+  std::vector<std::uint64_t> codesBuffer;
+  std::vector<std::uint32_t> orderBuffer;
+
+  /// Positions and masses of the sorted particles
+  std::vector<double> x, y, z, m;
+
+  /// The edge length of the root cube
+  double rootSize{0.};
+
+  /**
+   * Calculates the Morton codes of all particles that are not deleted within the bounding cube of these particles
+   */
+  void calculateMortonCodes();
+
+  /**
+   * Sorts the Morton codes and the particle order by a parallel least significant digit radix sort
+   */
+  void sortByMortonCode();
+
+  /**
+   * Appends the subtree of the sorted particles [begin, end) in pre-order to out
+   * @param out The nodes the subtree is appended to, the skip indices are relative to its beginning
+   * @param begin The first sorted particle of the subtree
+   * @param end The end of the sorted particles of the subtree
+   * @param level The depth of the root of the subtree
+   */
+  void buildSubtree(std::vector<Node> &out, std::uint32_t begin, std::uint32_t end, int level);
+
+  /**
+   * Rebuilds the tree over the current positions of the particles
+   */
+  void buildTree();
+
+  /**
+   * Calculates the gravitational force upon a sorted particle by traversing the tree
+   * @param k The index of the sorted particle
+   * @return The force acting upon the particle
+   */
+  [[nodiscard]] std::array<double, 3> calculateTreeForce(std::uint32_t k) const;
+
+ public:
+  /**
+   * Instantiates a Barnes-Hut container
+   * @param theta The opening angle, greater values are faster but less accurate
+   * @param leafSize The maximal number of particles in a leaf of the tree
+   */
+  explicit BarnesHutContainer(double theta = 0.5, size_t leafSize = 8);
+
+  /**
+   * Calculates the forces with the tree if the model is a NewtonsLawModel and there are no structures, otherwise
+   * applies the binary function to all pairs
+   * @param model The model that calculates the forces between two particles
+   * @param binaryFunction The function applied to all pairs if the tree is not used
+   */
+  void applyForceModel(IModel &model, std::function<void(Particle &, Particle &)> &binaryFunction) override;
+
+  [[nodiscard]] double getTheta() const { return theta; }
+
+  /**
+   * Returns the number of nodes of the last built tree. ONLY USED FOR TESTING
+   * @return The number of nodes
+   */
+  [[nodiscard]] size_t getNodeCount() const { return nodes.size(); }
+};
@@ -3,7 +3,6 @@
 
 #include <algorithm>
 #include <array>
-#include <list>
 #include <vector>
 
 #include "utils/ArrayUtils.h"
@@ -46,8 +45,8 @@ enum class CellType {
  * particles in it
  */
 struct cell {
-  /// List of pointers to the particles which are currently inside the cell
-  std::list<size_t> particles{};
+  /// Indices of the particles which are currently inside the cell
+  std::vector<size_t> particles{};
   /// The type of the cell
   CellType type = CellType::inner;
   /// Index of cell in the LinkedCellsContainer cell vector
@@ -202,7 +201,7 @@ struct cell {
     diagonalHaloCellPosition = getNextHaloPosition(diagonalHaloCellPosition, side1);
     diagonalHaloCellPosition = getNextHaloPosition(diagonalHaloCellPosition, side2);
 
-    std::array<double, 3> offset;
+    std::array<double, 3> offset{};
     offset = getCubeSizeBySide(side1, offset);
     offset = getCubeSizeBySide(side2, offset);
 
@@ -4,6 +4,10 @@
 
 #include "MembraneStructure.h"
 #include "Particle.h"
+#include "model/IModel.h"
+
+class LoadImbalanceStatistics;
+
 /**  \image html runtime.png width=900px
  *    \image latex runtime.png "Runtimes comparison" width = [goodwidth]cm
  */
@@ -16,6 +20,27 @@ class IContainer {
    */
   virtual void forEach(std::function<void(Particle &)> &unaryFunction) = 0;
 
+  /**
+   * Applies a function to all particles in the container, possibly in parallel
+   * @param unaryFunction A function taking a particle reference and returning nothing
+   * @note The function may be called concurrently for different particles, so it must only access the particle it
+   * gets passed and must not write to any shared state
+   */
+  virtual void forEachParallel(std::function<void(Particle &)> &unaryFunction) { forEach(unaryFunction); }
+
+  /**
+   * Sums up a value over all particles in the container, possibly in parallel
+   * @param unaryFunction A function taking a particle reference and returning the value of that particle
+   * @return The sum of the values of all particles
+   * @note The same contract as for forEachParallel applies. The order of the summation is not specified.
+   */
+  virtual double reduceSum(std::function<double(Particle &)> &unaryFunction) {
+    double sum{0.};
+    std::function<void(Particle &)> addToSum{[&sum, &unaryFunction](Particle &p) { sum += unaryFunction(p); }};
+    forEach(addToSum);
+    return sum;
+  }
+
   /**
    * Applies a function to all particle pairs in the container
    * @param binaryFunction A function taking two particle references and
@@ -26,6 +51,17 @@ class IContainer {
    */
   virtual void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) = 0;
 
+  /**
+   * Applies the force calculation of a model to all particle pairs in the container. Containers that keep their own
+   * memory layout of the particles let the model work on that layout directly, all others use forEachPair.
+   * @param model The model that calculates the forces between two particles
+   * @param binaryFunction A function applying the model onto two particle references
+   * @note binaryFunction may still be used for pairs the container can not hand to the model directly
+   */
+  virtual void applyForceModel(IModel &model, std::function<void(Particle &, Particle &)> &binaryFunction) {
+    forEachPair(binaryFunction);
+  }
+
   /**
    * Reserves storage and resizes the underlying datastructures
    * @param amount Specifies the count of Particles that should fit in the
@@ -78,6 +114,14 @@ class IContainer {
    */
   virtual std::vector<Particle> &getParticlesRef() = 0;
 
+  /**
+   * Returns the history of a particle, which the container keeps apart from the particles since only the statistics
+   * need it.
+   * @param particle A particle that was added to the container
+   * @return The history of the particle
+   */
+  virtual ParticleHistory &getHistory(const Particle &particle) = 0;
+
   /**
    * @return True, if the container has structures and supports structures. Otherwise false.
    */
@@ -96,4 +140,10 @@ class IContainer {
    * @return The container is packed densly
    */
   virtual bool isDense() { return false; }
+
+  /**
+   * @return The load imbalance between the threads of the parallel force calculation, or nullptr if the container
+   * does not measure it
+   */
+  virtual LoadImbalanceStatistics *getLoadImbalanceStatistics() { return nullptr; }
 };
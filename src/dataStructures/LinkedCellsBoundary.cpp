@@ -5,13 +5,15 @@
 #include "spdlog/spdlog.h"
 
 LinkedCellsBoundary::LinkedCellsBoundary(CubeSide side, BoundaryType type, std::vector<cell>& cells,
-                                         std::vector<Particle>* particlesVector, std::array<unsigned int, 3> dimensions,
-                                         std::array<double, 3>* leftLowerCorner,
+                                         std::vector<Particle>* particlesVector,
+                                         std::vector<ParticleHistory>* particleHistories,
+                                         std::array<unsigned int, 3> dimensions, std::array<double, 3>* leftLowerCorner,
                                          std::array<double, 3>* rightUpperCorner)
     : side{side},
       type{type},
       cubeDimensions{dimensions},
       particlesVector{particlesVector},
+      particleHistories{particleHistories},
       leftLowerCorner{leftLowerCorner},
       rightUpperCorner{rightUpperCorner} {
   // Add boundary cells
@@ -65,8 +67,10 @@ double LinkedCellsBoundary::getDistanceToBoundary(Particle const& particle) cons
   return relativePosition;
 }
 
-void LinkedCellsBoundary::deleteOutFlow() {
-  for (auto cell : connectedHalos) {
+void LinkedCellsBoundary::deleteOutFlow(bool parallel) {
+#pragma omp parallel for if (parallel) schedule(dynamic)
+  for (size_t haloIndex = 0; haloIndex < connectedHalos.size(); ++haloIndex) {
+    auto cell = connectedHalos[haloIndex];
     if (cell->isEmpty()) continue;
 
     for (auto particleIndex : cell->particles) {
@@ -79,7 +83,7 @@ void LinkedCellsBoundary::deleteOutFlow() {
 }
 
 using namespace ReflectiveBoundary;
-void LinkedCellsBoundary::reflectParticles() {
+void LinkedCellsBoundary::reflectParticles(bool parallel) {
   auto reflectParticle = [this](Particle& particle) {
     auto distance = getDistanceToBoundary(particle);
 
@@ -90,13 +94,15 @@ void LinkedCellsBoundary::reflectParticles() {
     auto ghostPos = particle.getX();
     ghostPos[getDimensionBySide(side)] -= 2 * distance;
 
-    // Todo: Make this more lightweight
-    Particle ghost{ghostPos};
+    // The ghost is a copy, so it has the type of the particle and the type tables are only read in the parallel loop
+    Particle ghost{particle};
+    ghost.setX(ghostPos);
     lennardJones.addForces(particle, ghost);
   };
 
-  for (cell* cell : connectedCells) {
-    for (auto particleIndex : cell->particles) {
+#pragma omp parallel for if (parallel) schedule(dynamic)
+  for (size_t cellIndex = 0; cellIndex < connectedCells.size(); ++cellIndex) {
+    for (auto particleIndex : connectedCells[cellIndex]->particles) {
       reflectParticle((*particlesVector)[particleIndex]);
     }
   }
@@ -116,8 +122,10 @@ std::array<double, 3> LinkedCellsBoundary::getPeriodicLocation(Particle& particl
   return newPos;
 }
 
-void LinkedCellsBoundary::teleportParticles() {
-  for (cell* halo : connectedHalos) {
+void LinkedCellsBoundary::teleportParticles(bool parallel) {
+#pragma omp parallel for if (parallel) schedule(dynamic)
+  for (size_t haloIndex = 0; haloIndex < connectedHalos.size(); ++haloIndex) {
+    cell* halo = connectedHalos[haloIndex];
     if (halo->isEmpty()) continue;
 
     for (auto particleIndex : halo->particles) {
@@ -127,22 +135,23 @@ void LinkedCellsBoundary::teleportParticles() {
         particle.setX(getPeriodicLocation(particle));
         size_t dimIndex = getDimensionBySide(side);
         bool leftRelative = side == CubeSide::LEFT || side == CubeSide::TOP || side == CubeSide::FRONT;
+        auto& crossed = (*particleHistories)[particle.getId()].periodicBoundariesCrossed;
         if (leftRelative) {
-          particle.getPeriodicBoundariesCrossed()[dimIndex]--;
+          crossed[dimIndex]--;
         } else {
-          particle.getPeriodicBoundariesCrossed()[dimIndex]++;
+          crossed[dimIndex]++;
         }
       }
     }
   }
 }
 
-void LinkedCellsBoundary::apply() {
+void LinkedCellsBoundary::apply(bool parallel) {
   if (type == BoundaryType::OUTFLOW)
-    deleteOutFlow();
+    deleteOutFlow(parallel);
   else if (type == BoundaryType::REFLECT) {
-    reflectParticles();
+    reflectParticles(parallel);
   } else {
-    teleportParticles();
+    teleportParticles(parallel);
   }
 }
@@ -39,6 +39,9 @@ class LinkedCellsBoundary {
   /// A reference to the particles vector of the corresponding container.
   std::vector<Particle>* particlesVector;
 
+  /// A reference to the particle histories of the corresponding container, indexed by the particle ids.
+  std::vector<ParticleHistory>* particleHistories;
+
   /// Left, lower, front corner of corresponding LinkedCells container in 3d
   std::array<double, 3>* leftLowerCorner;
 
@@ -106,13 +109,16 @@ class LinkedCellsBoundary {
    * @param cells Cells of the linkedCells container
    * @param particlesVector A pointer to the particlesVector of the container.
    *   This is required to allow e.g. particle deletion
+   * @param particleHistories A pointer to the particle histories of the container, which count the crossings of
+   *   periodic boundaries
    * @param dimensions The cell grid dimensions
    * @param leftLowerCorner The left lower front corner of the 3d container cube
    * @param rightUpperCorner The right upper back corner of the 3d container
    * cube
    */
   LinkedCellsBoundary(CubeSide side, BoundaryType type, std::vector<cell>& cells,
-                      std::vector<Particle>* particlesVector, std::array<unsigned int, 3> dimensions,
+                      std::vector<Particle>* particlesVector, std::vector<ParticleHistory>* particleHistories,
+                      std::array<unsigned int, 3> dimensions,
                       std::array<double, 3>* leftLowerCorner, std::array<double, 3>* rightUpperCorner);
 
   /**
@@ -132,25 +138,30 @@ class LinkedCellsBoundary {
 
   /**
    * Deletes particles that have left the boundary and entered a halo cell.
+   * @param parallel Whether the halo cells are processed in parallel
    */
-  void deleteOutFlow();
+  void deleteOutFlow(bool parallel);
 
   /**
    * Reflects particles that are near the edge using the Lennard Jones force.
    * Reflection distance is per convention: (6th root of 2) * sigma.
+   * @param parallel Whether the boundary cells are processed in parallel
    */
-  void reflectParticles();
+  void reflectParticles(bool parallel);
 
   /**
    * Implements the periodic boundary. Particles that leave the domain through a periodic boundary
    * get teleported to the other side of the LinkedCells container cube.
+   * @param parallel Whether the halo cells are processed in parallel
    */
-  void teleportParticles();
+  void teleportParticles(bool parallel);
 
   /**
    * Applies the effects of the current boundary
+   * @param parallel Whether the cells of the boundary are processed in parallel. Each cell is only touched by one
+   * thread, so this is safe as long as the boundaries are applied one after another.
    */
-  void apply();
+  void apply(bool parallel = false);
 
   /**
    * @return Boundary cells on which the boundary operates on.
@@ -1,5 +1,10 @@
 #include "LinkedCellsContainer.h"
 
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "LinkedCellsBoundary.h"
 #include "dataStructures/MembraneStructure.h"
 #include "utils/ArrayUtils.h"
@@ -122,43 +127,65 @@ void LinkedCellsContainer::forEach(std::function<void(Particle &)> &unaryFunctio
   }
 }
 
+void LinkedCellsContainer::forEachParallel(std::function<void(Particle &)> &unaryFunction) {
+#ifdef _OPENMP
+  if (parallelUpdates) {
+#pragma omp parallel for default(none) shared(unaryFunction) schedule(static)
+    for (size_t i = 0; i < particlesVector.size(); ++i) {
+      if (!particlesVector[i].isDeleted()) unaryFunction(particlesVector[i]);
+    }
+    return;
+  }
+#endif
+  forEach(unaryFunction);
+}
+
+double LinkedCellsContainer::reduceSum(std::function<double(Particle &)> &unaryFunction) {
+  double sum{0.};
+#ifdef _OPENMP
+#pragma omp parallel for default(none) shared(unaryFunction) reduction(+ : sum) schedule(static) if (parallelUpdates)
+#endif
+  for (size_t i = 0; i < particlesVector.size(); ++i) {
+    if (!particlesVector[i].isDeleted()) sum += unaryFunction(particlesVector[i]);
+  }
+  return sum;
+}
+
 void LinkedCellsContainer::forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) {
   recalculateStructure();
   applyBoundaries();
+  if (hasPeriodicBoundaries) createGhostParticles();
 
-  if (hasPeriodicBoundaries) {
-    // TODO: SAVE THIS CALL BY MANUALLY RELINKING PARTICLES!
-    recalculateStructure();
-    applyPeriodicForces(binaryFunction);
-  }
+  forEachCellPair(binaryFunction);
 
-  for (size_t index = 0; index < cells.size(); ++index) {
-    if (cells[index].type == CellType::halo || cells[index].isEmpty()) continue;
-    for (size_t indexOffset : indexOffsetAdjacent) {
-      // Special case to match particles within one cell
-      if (indexOffset == 0) {
-        auto &particles = cells[index].particles;
-        for (auto first = particles.begin(); first != particles.end(); ++first) {
-          for (auto second = std::next(first); second != particles.end(); ++second) {
-            binaryFunction(particlesVector[*first], particlesVector[*second]);
-          }
-        }
-      } else {
-        // Loop so the particles of each of the two cells and match them
-        for (auto indexA : cells[index].particles) {
-          for (auto indexB : cells[index + indexOffset].particles) {
-            binaryFunction(particlesVector[indexA], particlesVector[indexB]);
-          }
-        }
-      }
-    }
-  }
+  if (hasPeriodicBoundaries) removeGhostParticles();
 
   for (auto &structure : structuresVector) {
     if (structure.hasArtificalForces()) structure.applyArtificialForces();
   }
 }
 
+void LinkedCellsContainer::forEachPairAndFinalize(std::function<void(Particle &, Particle &)> &binaryFunction,
+                                                  std::function<void(Particle &)> &finalizeFunction) {
+  // The artificial forces of structures are applied after the pair loop, so the particles can only be finalized then
+  if (containsStructures()) {
+    forEachPair(binaryFunction);
+    forEach(finalizeFunction);
+    return;
+  }
+
+  recalculateStructure();
+  applyBoundaries();
+  if (hasPeriodicBoundaries) createGhostParticles();
+
+  forEachCellPair(binaryFunction, finalizeFunction);
+
+  if (hasPeriodicBoundaries) {
+    removeGhostParticles();
+    finalizeDeferredCells(finalizeFunction);
+  }
+}
+
 void LinkedCellsContainer::reserve(size_t amount) { particlesVector.reserve(amount); }
 size_t LinkedCellsContainer::capacity() { return particlesVector.capacity(); }
 
@@ -171,14 +198,16 @@ void LinkedCellsContainer::emplace_back(std::array<double, 3> x_arg, std::array<
   particlesVector.emplace_back(x_arg, v_arg, m_arg, type);
   size_t index = getCellIndexOfPosition(x_arg);
   cells[index].particles.push_back(particlesVector.size() - 1);
-  particlesVector.back().setId(particlesVector.size() - 1);
+  particlesVector.back().setId(particleHistories.size());
+  particleHistories.emplace_back();
 }
 
 void LinkedCellsContainer::push_back(Particle &particle) {
   particlesVector.push_back(std::forward<Particle &>(particle));
   size_t index = getCellIndexOfPosition(particle.getX());
   cells[index].particles.push_back(particlesVector.size() - 1);
-  particlesVector.back().setId(particlesVector.size() - 1);
+  particlesVector.back().setId(particleHistories.size());
+  particleHistories.emplace_back();
 }
 
 void LinkedCellsContainer::push_back(MembraneStructure membrane) {
@@ -187,25 +216,172 @@ void LinkedCellsContainer::push_back(MembraneStructure membrane) {
 }
 
 void LinkedCellsContainer::recalculateStructure() {
+  ScopedPhaseTimer timer{Phase::Rebinning};
+  if (sortInterval != 0 && !containsStructures() && structureUpdateCount++ % sortInterval == 0) {
+#ifdef _OPENMP
+    if (parallelUpdates) {
+      sortParticlesByCellParallel();
+      return;
+    }
+#endif
+    sortParticlesByCell();
+    return;
+  }
+
+#ifdef _OPENMP
+  if (parallelUpdates) {
+    recalculateStructureParallel();
+    return;
+  }
+#endif
+
   // Loop through each cell
   for (size_t cellIndex = 0; cellIndex < cells.size(); ++cellIndex) {
     // Loop through each particle of that cell
     auto &particles = cells[cellIndex].particles;
-    for (auto it = particles.begin(); it != particles.end();) {
-      auto pos = particlesVector[(*it)].getX();
+    for (size_t i = 0; i < particles.size();) {
+      auto pos = particlesVector[particles[i]].getX();
       size_t correctIndex = getCellIndexOfPosition(pos);
       if (correctIndex != cellIndex) {
-        // Delete particle and push it into correct cell, if it is currently in
-        // the wrong cell
-        cells[correctIndex].particles.push_back(*it);
-        it = particles.erase(it);
+        // Push particle into correct cell, if it is currently in the wrong cell. The last particle of the cell takes
+        // its place.
+        cells[correctIndex].particles.push_back(particles[i]);
+        particles[i] = particles.back();
+        particles.pop_back();
       } else {
-        ++it;
+        ++i;
       }
     }
   }
 }
 
+void LinkedCellsContainer::sortParticlesByCell() {
+  // Count the particles of each cell. Deleted particles get the index cells.size(), so they are dropped.
+  sortCellIndices.resize(particlesVector.size());
+  sortCellStarts.assign(cells.size() + 1, 0);
+  for (size_t i = 0; i < particlesVector.size(); ++i) {
+    if (particlesVector[i].isDeleted()) {
+      sortCellIndices[i] = cells.size();
+      continue;
+    }
+
+    sortCellIndices[i] = getCellIndexOfPosition(particlesVector[i].getX());
+    ++sortCellStarts[sortCellIndices[i] + 1];
+  }
+
+  // Prefix sum: sortCellStarts[c] becomes the first index of cell c in the sorted particles vector
+  for (size_t c = 0; c < cells.size(); ++c) sortCellStarts[c + 1] += sortCellStarts[c];
+
+  // Scatter the particles to their sorted position and rebuild the cell index lists along the way
+  sortBuffer.resize(sortCellStarts.back());
+  for (auto &c : cells) c.particles.clear();
+
+  for (size_t i = 0; i < particlesVector.size(); ++i) {
+    size_t cellIndex = sortCellIndices[i];
+    if (cellIndex == cells.size()) continue;
+
+    size_t sortedIndex = sortCellStarts[cellIndex]++;
+    sortBuffer[sortedIndex] = particlesVector[i];
+    cells[cellIndex].particles.push_back(sortedIndex);
+  }
+
+  // Swap the contents, so that references to the particles vector object (e.g. in the boundaries) stay valid
+  particlesVector.swap(sortBuffer);
+  ++reorderCount;
+}
+
+#ifdef _OPENMP
+void LinkedCellsContainer::recalculateStructureParallel() {
+  size_t particleCount = particlesVector.size();
+  size_t cellCount = cells.size();
+
+  // Compute the cell of each particle and count the particles per cell. Deleted particles get the index cells.size().
+  sortCellIndices.resize(particleCount);
+  sortCellStarts.assign(cellCount, 0);
+#pragma omp parallel for default(none) shared(particleCount, cellCount) schedule(static)
+  for (size_t i = 0; i < particleCount; ++i) {
+    if (particlesVector[i].isDeleted()) {
+      sortCellIndices[i] = cellCount;
+      continue;
+    }
+
+    size_t cellIndex = getCellIndexOfPosition(particlesVector[i].getX());
+    sortCellIndices[i] = cellIndex;
+#pragma omp atomic
+    ++sortCellStarts[cellIndex];
+  }
+
+  // Resize the cells, sortCellStarts is reused as the insert position of each cell
+#pragma omp parallel for default(none) shared(cellCount) schedule(static)
+  for (size_t c = 0; c < cellCount; ++c) {
+    cells[c].particles.resize(sortCellStarts[c]);
+    sortCellStarts[c] = 0;
+  }
+
+#pragma omp parallel for default(none) shared(particleCount, cellCount) schedule(static)
+  for (size_t i = 0; i < particleCount; ++i) {
+    size_t cellIndex = sortCellIndices[i];
+    if (cellIndex == cellCount) continue;
+
+    size_t position;
+#pragma omp atomic capture
+    position = sortCellStarts[cellIndex]++;
+    cells[cellIndex].particles[position] = i;
+  }
+
+  // The scatter order depends on the threads, sorting makes the traversal order and thus the results reproducible
+#pragma omp parallel for default(none) shared(cellCount) schedule(dynamic, 64)
+  for (size_t c = 0; c < cellCount; ++c) std::sort(cells[c].particles.begin(), cells[c].particles.end());
+}
+
+void LinkedCellsContainer::sortParticlesByCellParallel() {
+  recalculateStructureParallel();
+
+  // Exclusive prefix sum over the cell sizes. Each thread sums up one contiguous chunk of cells, the chunk sums are
+  // scanned by one thread and then each thread adds the offset of its chunk.
+  size_t cellCount = cells.size();
+  sortCellStarts.resize(cellCount + 1);
+  std::vector<size_t> chunkOffsets(omp_get_max_threads() + 1, 0);
+
+#pragma omp parallel default(none) shared(cellCount, chunkOffsets)
+  {
+    size_t threadCount = omp_get_num_threads();
+    size_t threadNum = omp_get_thread_num();
+    size_t chunkBegin = cellCount * threadNum / threadCount;
+    size_t chunkEnd = cellCount * (threadNum + 1) / threadCount;
+
+    size_t sum = 0;
+    for (size_t c = chunkBegin; c < chunkEnd; ++c) {
+      sortCellStarts[c] = sum;
+      sum += cells[c].particles.size();
+    }
+    chunkOffsets[threadNum + 1] = sum;
+
+#pragma omp barrier
+#pragma omp single
+    for (size_t t = 0; t < threadCount; ++t) chunkOffsets[t + 1] += chunkOffsets[t];
+
+    for (size_t c = chunkBegin; c < chunkEnd; ++c) sortCellStarts[c] += chunkOffsets[threadNum];
+    if (threadNum == threadCount - 1) sortCellStarts[cellCount] = chunkOffsets[threadCount];
+  }
+
+  // Copy each cell to its sorted position. The particle indices of each cell are sorted, so the result equals the one
+  // of the serial counting sort.
+  sortBuffer.resize(sortCellStarts.back());
+#pragma omp parallel for default(none) shared(cellCount) schedule(dynamic, 64)
+  for (size_t c = 0; c < cellCount; ++c) {
+    size_t sortedIndex = sortCellStarts[c];
+    for (auto &particleIndex : cells[c].particles) {
+      sortBuffer[sortedIndex] = particlesVector[particleIndex];
+      particleIndex = sortedIndex++;
+    }
+  }
+
+  particlesVector.swap(sortBuffer);
+  ++reorderCount;
+}
+#endif
+
 [[maybe_unused]] void LinkedCellsContainer::setBoundaries(std::vector<std::pair<CubeSide, BoundaryType>> sideAndType) {
   // Ensure that boundary[0] always is the LEFT one, etc.
   std::sort(sideAndType.begin(), sideAndType.end(), [](std::pair<CubeSide, BoundaryType> lhs, auto rhs) {
@@ -213,7 +389,8 @@ void LinkedCellsContainer::recalculateStructure() {
   });
 
   for (auto [side, type] : sideAndType) {
-    boundaries.emplace_back(side, type, cells, &particlesVector, dimensions, &leftLowerCorner, &rightUpperCorner);
+    boundaries.emplace_back(side, type, cells, &particlesVector, &particleHistories, dimensions, &leftLowerCorner,
+                            &rightUpperCorner);
   }
 
   for (auto &boundary : boundaries) {
@@ -363,6 +540,7 @@ void LinkedCellsContainer::linkCornerBoundaryCells() {
 }
 
 void LinkedCellsContainer::applyPeriodicForces(std::function<void(Particle &, Particle &)> &binaryFunction) {
+  ScopedPhaseTimer timer{Phase::PeriodicForces};
   for (cell &halo : cells) {
     if (halo.type != CellType::halo) continue;
 
@@ -385,3 +563,72 @@ void LinkedCellsContainer::applyPeriodicForces(std::function<void(Particle &, Pa
     }
   }
 }
+
+void LinkedCellsContainer::relinkHaloParticles() {
+  for (auto &halo : cells) {
+    if (halo.type != CellType::halo) continue;
+
+    auto &particles = halo.particles;
+    for (size_t i = 0; i < particles.size();) {
+      auto &particle = particlesVector[particles[i]];
+      if (!particle.isDeleted()) {
+        size_t correctIndex = getCellIndexOfPosition(particle.getX());
+        if (correctIndex == halo.cellVectorIndex) {
+          ++i;
+          continue;
+        }
+        cells[correctIndex].particles.push_back(particles[i]);
+      }
+
+      // The particle was deleted or moved to another cell, the last particle of the cell takes its place
+      particles[i] = particles.back();
+      particles.pop_back();
+    }
+  }
+}
+
+void LinkedCellsContainer::createGhostParticles() {
+  ScopedPhaseTimer timer{Phase::PeriodicForces};
+  if (periodicHaloCells.empty()) {
+    hasPeriodicImages.assign(cells.size(), false);
+    for (auto &halo : cells) {
+      if (halo.type != CellType::halo || halo.periodicPartners.empty()) continue;
+      periodicHaloCells.push_back(halo.cellVectorIndex);
+      for (auto &partner : halo.periodicPartners) hasPeriodicImages[partner.pCell->cellVectorIndex] = true;
+    }
+  }
+
+  realParticleCount = particlesVector.size();
+  ghostOrigins.clear();
+
+  for (size_t haloIndex : periodicHaloCells) {
+    auto &halo = cells[haloIndex];
+    for (cell::PeriodicPartner &partner : halo.periodicPartners) {
+      for (size_t pIndex : partner.pCell->particles) {
+        // The ghost is a copy of the particle at its periodic image position, without the forces of the particle
+        Particle ghost{particlesVector[pIndex]};
+        ghost.setX(ghost.getX() + partner.offset);
+        ghost.setF({0., 0., 0.});
+
+        ghostOrigins.push_back(pIndex);
+        halo.particles.push_back(particlesVector.size());
+        particlesVector.push_back(ghost);
+      }
+    }
+  }
+}
+
+void LinkedCellsContainer::removeGhostParticles() {
+  ScopedPhaseTimer timer{Phase::PeriodicForces};
+  // The ghosts were appended to the halo cells, so they are at the end of each particle list
+  for (size_t haloIndex : periodicHaloCells) {
+    auto &particles = cells[haloIndex].particles;
+    while (!particles.empty() && particles.back() >= realParticleCount) particles.pop_back();
+  }
+
+  for (size_t ghost = 0; ghost < ghostOrigins.size(); ++ghost) {
+    particlesVector[ghostOrigins[ghost]].applyForce(particlesVector[realParticleCount + ghost].getF());
+  }
+
+  particlesVector.resize(realParticleCount);
+}
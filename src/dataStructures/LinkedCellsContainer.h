@@ -1,12 +1,15 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
-#include <list>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 #include "Cell.h"
 #include "IContainer.h"
 #include "LinkedCellsBoundary.h"
+#include "utils/PhaseTimers.h"
 
 /**  \image html runtime-linkedcells.png width=900px
  *    \image latex runtime-linkedcells.png "Runtime" width = [goodwidth]cm
@@ -16,6 +19,9 @@ class LinkedCellsContainer : public IContainer {
   /// The vector containing all the particles
   std::vector<Particle> particlesVector;
 
+  /// The histories of the particles, indexed by their id
+  std::vector<ParticleHistory> particleHistories;
+
   /// The vector containing all structures. (Only membranes for now, worksheet 5)
   std::vector<MembraneStructure> structuresVector;
 
@@ -26,7 +32,41 @@ class LinkedCellsContainer : public IContainer {
   std::vector<LinkedCellsBoundary> boundaries{};
 
   /// Whether the container uses periodic boundaries
-  bool hasPeriodicBoundaries;
+  bool hasPeriodicBoundaries{false};
+
+  /// Every sortInterval-th structure update the particles vector is sorted by cell. 0 disables sorting.
+  size_t sortInterval{0};
+
+  /// Counts the structure updates to determine when the particles vector has to be sorted again
+  size_t structureUpdateCount{0};
+
+  /// Counts how often the particles vector was reordered, so that data indexed by particle index can detect it
+  size_t reorderCount{0};
+
+  /// Buffer the particles get sorted into, kept to avoid reallocations
+  std::vector<Particle> sortBuffer;
+
+  /// Buffer holding the cell index of each particle while sorting
+  std::vector<size_t> sortCellIndices;
+
+  /// Buffer holding the start index of each cell in the sorted particles vector while sorting
+  std::vector<size_t> sortCellStarts;
+
+  /// Whether structure updates, boundaries and periodic forces are processed in parallel. Set by the parallel
+  /// containers, only has an effect if OpenMP is enabled.
+  bool parallelUpdates{false};
+
+  /// The halo cells with periodic partners, in ascending order
+  std::vector<size_t> periodicHaloCells;
+
+  /// For each cell, whether its particles have periodic images in the halo cells
+  std::vector<bool> hasPeriodicImages;
+
+  /// The index of the original particle of each ghost particle. The ghosts are stored after the real particles.
+  std::vector<size_t> ghostOrigins;
+
+  /// The number of particles in the particles vector without the ghost particles
+  size_t realParticleCount{0};
 
   /// Edge length of a cell
   double gridSize;
@@ -62,6 +102,139 @@ class LinkedCellsContainer : public IContainer {
    */
   size_t getVectorIndexFromCoord(size_t x, size_t y, size_t z);
 
+  /**
+   * Sorts the particles vector by cell index with a counting sort, so that the particles of each cell lie contiguous
+   * in memory and each cell holds an ascending range of indices. Deleted particles are removed in the process.
+   */
+  void sortParticlesByCell();
+
+#ifdef _OPENMP
+  /**
+   * Parallel version of the structure update: the cell index of each particle is computed in parallel, the cells are
+   * resized to their new particle counts and the particle indices are scattered into them. Afterwards each cell is
+   * sorted, so that the result does not depend on the scheduling. Deleted particles are removed.
+   */
+  void recalculateStructureParallel();
+
+  /**
+   * Parallel version of sortParticlesByCell. After a parallel structure update the start of each cell in the sorted
+   * particles vector is computed with a parallel prefix sum, then the cells are copied in parallel.
+   */
+  void sortParticlesByCellParallel();
+#endif
+
+  /**
+   * Moves the particles of the halo cells into their correct cells after the boundaries were applied and removes
+   * deleted particles from the cells. Only the halo cells are checked, since only their particles get moved or deleted
+   * by the boundaries.
+   */
+  void relinkHaloParticles();
+
+  /**
+   * Creates the periodic images of the particles as ghost particles in the halo cells, so that the pairs through the
+   * periodic boundaries are handled by the normal cell pair loop. The ghosts are appended to the particles vector and
+   * to the halo cells. Has to be followed by removeGhostParticles once the forces are calculated.
+   */
+  void createGhostParticles();
+
+  /**
+   * Adds the forces of the ghost particles onto their original particles and removes the ghosts
+   */
+  void removeGhostParticles();
+
+  /**
+   * Applies the function to all particle pairs within a cell and between adjacent cells. Halo cells are only visited
+   * as partners of the other cells. Templated, so that the function can be inlined into the cell loop.
+   * @param binaryFunction The function that gets applied onto each particle pair
+   * @param finalizeFunction If given, it gets applied onto the particles of each cell as soon as all pairs of that cell
+   * are done. The cells are visited in ascending order and the partner cells have greater indices, so all pairs with a
+   * particle of a cell are done after the cell itself was visited. With periodic boundaries, cells with periodic images
+   * also receive the forces of their ghosts and the halo cells contain the ghosts, so these cells are skipped and have
+   * to be finalized with finalizeDeferredCells after removeGhostParticles.
+   */
+  template <typename BinaryFunction, typename UnaryFunction = std::nullptr_t>
+  void forEachCellPair(BinaryFunction &binaryFunction, UnaryFunction finalizeFunction = nullptr) {
+    ScopedPhaseTimer timer{Phase::PairLoop};
+    for (size_t index = 0; index < cells.size(); ++index) {
+      if (cells[index].type != CellType::halo) applyToCellPairs(index, binaryFunction);
+
+      if constexpr (!std::is_null_pointer_v<UnaryFunction>) {
+        if (isFinalizationDeferred(index)) continue;
+        for (auto particleIndex : cells[index].particles) {
+          if (!particlesVector[particleIndex].isDeleted()) finalizeFunction(particlesVector[particleIndex]);
+        }
+      }
+    }
+  }
+
+  /**
+   * @param index The index of the cell
+   * @return Whether forEachCellPair skips the finalization of the cell
+   */
+  bool isFinalizationDeferred(size_t index) {
+    return hasPeriodicBoundaries && (hasPeriodicImages[index] || cells[index].type == CellType::halo);
+  }
+
+  /**
+   * Applies the function onto the particles of the cells that are skipped by forEachCellPair
+   * @param finalizeFunction The function that gets applied onto each particle
+   */
+  template <typename UnaryFunction>
+  void finalizeDeferredCells(UnaryFunction &finalizeFunction) {
+    for (size_t index = 0; index < cells.size(); ++index) {
+      if (!isFinalizationDeferred(index)) continue;
+      for (auto particleIndex : cells[index].particles) {
+        if (!particlesVector[particleIndex].isDeleted()) finalizeFunction(particlesVector[particleIndex]);
+      }
+    }
+  }
+
+  /**
+   * Applies the function to all particle pairs within the cell and between the cell and its adjacent cells with
+   * greater indices
+   * @param index The index of the cell
+   * @param binaryFunction The function that gets applied onto each particle pair
+   */
+  template <typename BinaryFunction>
+  void applyToCellPairs(size_t index, BinaryFunction &binaryFunction) {
+    if (cells[index].isEmpty()) return;
+    for (size_t indexOffset : indexOffsetAdjacent) {
+      // Special case to match particles within one cell
+      if (indexOffset == 0) {
+        auto &particles = cells[index].particles;
+        for (auto first = particles.begin(); first != particles.end(); ++first) {
+          for (auto second = std::next(first); second != particles.end(); ++second) {
+            binaryFunction(particlesVector[*first], particlesVector[*second]);
+          }
+        }
+      } else {
+        // Loop so the particles of each of the two cells and match them
+        for (auto indexA : cells[index].particles) {
+          for (auto indexB : cells[index + indexOffset].particles) {
+            binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Estimates the cost of applyToCellPairs by the number of particle pairs it visits, i.e. n(n - 1) / 2 within the
+   * cell plus n * m for each adjacent cell with m particles
+   * @param index The index of the cell
+   * @return The number of particle pairs of the cell
+   */
+  [[nodiscard]] std::uint64_t estimateCellPairCost(size_t index) const {
+    std::uint64_t count = cells[index].particles.size();
+    if (count == 0) return 0;
+
+    std::uint64_t neighbourCount = 0;
+    for (size_t indexOffset : indexOffsetAdjacent) {
+      if (indexOffset != 0) neighbourCount += cells[index + indexOffset].particles.size();
+    }
+    return count * (count - 1) / 2 + count * neighbourCount;
+  }
+
  public:
   /** All the offsets for adjacent cells which have a greater index than the
    * current one, it has a length of 14 since their are 26 adjacent cells to one
@@ -98,8 +271,55 @@ class LinkedCellsContainer : public IContainer {
 
   void forEach(std::function<void(Particle &)> &unaryFunction) override;
 
+  /**
+   * Applies a function to all particles. The particles are processed in parallel if the container uses parallel
+   * updates, otherwise this equals forEach.
+   * @copydetails IContainer::forEachParallel
+   */
+  void forEachParallel(std::function<void(Particle &)> &unaryFunction) override;
+
+  /**
+   * Sums up a value over all particles. The sum is reduced in parallel if the container uses parallel updates.
+   * @copydetails IContainer::reduceSum
+   */
+  double reduceSum(std::function<double(Particle &)> &unaryFunction) override;
+
   void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) override;
 
+  /**
+   * Applies the model to all particle pairs like forEachPair, but calls the force calculation of the concrete model
+   * directly instead of via std::function and the virtual addForces, so that it can be inlined into the cell loop.
+   * @tparam Model The concrete type of the model
+   * @param model The model that calculates the forces between two particles
+   * @param finalizeFunction If given, it gets applied onto each particle as soon as all of its forces are known
+   * @note Structures are not supported, since the pairs within structures need their own force calculation
+   */
+  template <typename Model, typename UnaryFunction = std::nullptr_t>
+  void forEachPairWithModel(Model const &model, UnaryFunction finalizeFunction = nullptr) {
+    auto addForces = [&model](Particle &p1, Particle &p2) { model.Model::addForces(p1, p2); };
+
+    recalculateStructure();
+    applyBoundaries();
+    if (hasPeriodicBoundaries) createGhostParticles();
+
+    forEachCellPair(addForces, finalizeFunction);
+
+    if (hasPeriodicBoundaries) {
+      removeGhostParticles();
+      if constexpr (!std::is_null_pointer_v<UnaryFunction>) finalizeDeferredCells(finalizeFunction);
+    }
+  }
+
+  /**
+   * Applies binaryFunction to all particle pairs like forEachPair and afterwards finalizeFunction to all particles.
+   * Without structures the particles of each cell are finalized during the pair loop, right after their last pair, so
+   * they are still in the cache.
+   * @param binaryFunction The function that gets applied onto each particle pair
+   * @param finalizeFunction The function that gets applied onto each particle once all of its pairs are done
+   */
+  void forEachPairAndFinalize(std::function<void(Particle &, Particle &)> &binaryFunction,
+                              std::function<void(Particle &)> &finalizeFunction);
+
   /**
    * Applies binaryFunction to all particles within the same cell and surrounding cell of the particle.
    * Use these function for external, unlinked particles. I. e. for force calculation with ghost particles!
@@ -126,9 +346,18 @@ class LinkedCellsContainer : public IContainer {
   /**
    * Reorders the datastructure to make sure all particles are in the correct
    * cell, is automatically called before each forEachPair call
+   * @note If a sort interval is set, the particles vector itself is sorted by cell every sortInterval-th call
    */
   void recalculateStructure();
 
+  /**
+   * Sets how often the particles vector gets sorted by cell during structure updates. Sorting keeps the particles of a
+   * cell contiguous in memory, but changes the indices of the particles. Containers with structures are never sorted,
+   * since structures rely on the indices of their particles.
+   * @param interval Sort every interval-th structure update, 0 disables sorting
+   */
+  void setSortInterval(size_t interval) { sortInterval = interval; }
+
   /**
    * Sets boundaries of the chosen type on the chosen side of the container
    * @param sideAndType Pairs of the side and corresponding boundary type
@@ -139,14 +368,17 @@ class LinkedCellsContainer : public IContainer {
   [[maybe_unused]] void setBoundaries(std::vector<std::pair<CubeSide, BoundaryType>> sideAndType);
 
   /**
-   * Applies the effects of all boundaries on the container
+   * Applies the effects of all boundaries on the container and relinks the particles they moved
    */
   inline void applyBoundaries() {
-    for (auto &boundary : boundaries) boundary.apply();
+    ScopedPhaseTimer timer{Phase::Boundaries};
+    for (auto &boundary : boundaries) boundary.apply(parallelUpdates);
+    relinkHaloParticles();
   }
 
   /**
-   * Applies function to particle pairs through periodic boundaries.
+   * Applies function to particle pairs through periodic boundaries by moving the particles into the halo cells one by
+   * one. Used by containers that can not handle ghost particles, otherwise see createGhostParticles.
    * @param binaryFunction The function that gets applied onto each particle pair
    */
   void applyPeriodicForces(std::function<void(Particle &, Particle &)> &binaryFunction);
@@ -195,6 +427,8 @@ class LinkedCellsContainer : public IContainer {
    */
   [[nodiscard]] std::vector<Particle> &getParticlesRef() override { return particlesVector; }
 
+  ParticleHistory &getHistory(const Particle &particle) override { return particleHistories.at(particle.getId()); }
+
   /**
    * @return True if the linked cells container has structures
    */
@@ -0,0 +1,83 @@
+#include "LinkedCellsContainerSoA.h"
+
+#include <typeinfo>
+
+#include "model/LennardJonesModel.h"
+#include "spdlog/spdlog.h"
+
+LinkedCellsContainerSoA::LinkedCellsContainerSoA(double cellSize, std::array<double, 3> leftLowerBound,
+                                                 std::array<double, 3> rightUpperBound)
+    : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound) {
+  setLennardJonesKernel(LennardJonesKernels::detectKernelType());
+}
+
+void LinkedCellsContainerSoA::setLennardJonesKernel(LennardJonesKernels::KernelType type) {
+  lennardJonesKernel = LennardJonesKernels::getKernel(type);
+  spdlog::debug("Using the {} Lennard-Jones kernel.", LennardJonesKernels::getName(type));
+}
+
+void LinkedCellsContainerSoA::loadSoA() {
+  soaOrder.clear();
+  cellStarts.resize(cells.size() + 1);
+  for (size_t index = 0; index < cells.size(); ++index) {
+    cellStarts[index] = soaOrder.size();
+    soaOrder.insert(soaOrder.end(), cells[index].particles.begin(), cells[index].particles.end());
+  }
+  cellStarts.back() = soaOrder.size();
+
+  soa.load(particlesVector, soaOrder);
+}
+
+template <typename RangeFunction>
+void LinkedCellsContainerSoA::forEachCellRange(RangeFunction rangeFunction) {
+  for (size_t index = 0; index < cells.size(); ++index) {
+    if (cells[index].type == CellType::halo || cells[index].isEmpty()) continue;
+    size_t begin = cellStarts[index];
+    size_t end = cellStarts[index + 1];
+
+    for (size_t indexOffset : indexOffsetAdjacent) {
+      // Special case to match particles within one cell
+      if (indexOffset == 0) {
+        for (size_t i = begin; i < end; ++i) rangeFunction(i, i + 1, end);
+      } else {
+        size_t partnerBegin = cellStarts[index + indexOffset];
+        size_t partnerEnd = cellStarts[index + indexOffset + 1];
+        if (partnerBegin == partnerEnd) continue;
+
+        for (size_t i = begin; i < end; ++i) rangeFunction(i, partnerBegin, partnerEnd);
+      }
+    }
+  }
+}
+
+void LinkedCellsContainerSoA::applyForceModel(IModel &model,
+                                              std::function<void(Particle &, Particle &)> &binaryFunction) {
+  // Pairs within structures need the particle objects, so they are not supported by the structure of arrays
+  if (containsStructures()) {
+    forEachPair(binaryFunction);
+    return;
+  }
+
+  recalculateStructure();
+  applyBoundaries();
+  if (hasPeriodicBoundaries) createGhostParticles();
+
+  ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
+  loadSoA();
+
+  if (typeid(model) == typeid(LennardJonesModel)) {
+    double cutOffRadiusSquared = static_cast<LennardJonesModel &>(model).getCutOffRadiusSquared();
+    forEachCellRange([this, cutOffRadiusSquared](size_t i, size_t begin, size_t end) {
+      lennardJonesKernel(soa, i, begin, end, cutOffRadiusSquared);
+    });
+  } else {
+    forEachCellRange([this, &model](size_t i, size_t begin, size_t end) {
+      for (size_t j = begin; j < end; ++j) model.addForcesSoA(soa, i, j);
+    });
+  }
+
+  soa.storeForces(particlesVector, soaOrder);
+  pairLoopTimer.stop();
+
+  if (hasPeriodicBoundaries) removeGhostParticles();
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "LinkedCellsContainer.h"
+#include "ParticleSoA.h"
+#include "model/LennardJonesKernels.h"
+
+/**
+ * Linked cells container that evaluates the force model on a structure of arrays copy of its particles. The particle
+ * vector stays the primary storage, so integration, thermostats and writers keep working on it. Before the pair loop
+ * the particles are mirrored into the structure of arrays ordered by cell, so that the particles of each cell form a
+ * contiguous range, and afterwards the accumulated forces are written back. For the Lennard-Jones model a vectorized
+ * kernel processes one particle against a whole range at once.
+ */
+class LinkedCellsContainerSoA : public LinkedCellsContainer {
+ private:
+  /// The structure of arrays the pair loop operates on
+  ParticleSoA soa;
+
+  /// The index in the particles vector of each entry of the structure of arrays
+  std::vector<size_t> soaOrder;
+
+  /// The first index of each cell in the structure of arrays, followed by the total number of entries
+  std::vector<size_t> cellStarts;
+
+  /// The kernel used for the Lennard-Jones model
+  LennardJonesKernels::Kernel lennardJonesKernel;
+
+  /**
+   * Mirrors the particles into the structure of arrays, ordered by cell
+   */
+  void loadSoA();
+
+  /**
+   * Calls the function for each particle with the range of its partners, that is the rest of its own cell and the
+   * whole range of each adjacent cell with a greater index.
+   * @param rangeFunction Called with the index of the particle and the begin and end of the range
+   */
+  template <typename RangeFunction>
+  void forEachCellRange(RangeFunction rangeFunction);
+
+ public:
+  /**
+   * Instantiating a LinkedCells Container with structure of arrays force calculation
+   * @param cellSize The edge length of a cell
+   * @param leftLowerBound The left lower corner of the domain bounding box
+   * @param rightUpperBound The right upper corner of the domain bounding box
+   */
+  LinkedCellsContainerSoA(double cellSize, std::array<double, 3> leftLowerBound, std::array<double, 3> rightUpperBound);
+
+  /**
+   * Applies the model to all particle pairs via the structure of arrays layout.
+   * @param model The model that calculates the forces between two particles
+   * @param binaryFunction Used for periodic boundaries and as a fallback when the container holds structures
+   */
+  void applyForceModel(IModel &model, std::function<void(Particle &, Particle &)> &binaryFunction) override;
+
+  /**
+   * Selects the kernel used for the Lennard-Jones model. By default the widest kernel the CPU supports is used.
+   * @param type The kernel type, has to be supported by the CPU
+   */
+  void setLennardJonesKernel(LennardJonesKernels::KernelType type);
+
+  /**
+   * Returns the structure of arrays the last force calculation operated on. ONLY USED FOR TESTING
+   * @return A const reference to the structure of arrays
+   */
+  const ParticleSoA &getSoA() const { return soa; }
+};
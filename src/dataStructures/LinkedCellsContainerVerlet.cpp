@@ -0,0 +1,95 @@
+#include "LinkedCellsContainerVerlet.h"
+
+#include "spdlog/spdlog.h"
+#include "utils/ArrayUtils.h"
+using ArrayUtils::dotProduct;
+
+LinkedCellsContainerVerlet::LinkedCellsContainerVerlet(double cellSize, std::array<double, 3> leftLowerBound,
+                                                       std::array<double, 3> rightUpperBound, double cutOffRadius,
+                                                       double skin)
+    : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound), cutOffRadius{cutOffRadius}, skin{skin} {
+  if (skin < 0) throw std::invalid_argument("The skin of the Verlet lists must not be negative.");
+
+  if (cellSize < cutOffRadius + skin)
+    spdlog::warn("Cell size {} is smaller than cut off radius + skin ({}). Some pairs may be missing in the neighbor "
+                 "lists.",
+                 cellSize, cutOffRadius + skin);
+}
+
+bool LinkedCellsContainerVerlet::needsRebuild() {
+  // The neighbor lists and positions are indexed by particle index, which a sort by cell changes
+  if (rebuildCount == 0 || reorderCountAtBuild != reorderCount || positionsAtBuild.size() != particlesVector.size())
+    return true;
+
+  double maxDisplacementSquared = skin * skin / 4;
+  for (size_t i = 0; i < particlesVector.size(); ++i) {
+    if (particlesVector[i].isDeleted()) continue;
+    if (dotProduct(particlesVector[i].getX() - positionsAtBuild[i]) > maxDisplacementSquared) return true;
+  }
+
+  return false;
+}
+
+void LinkedCellsContainerVerlet::rebuildNeighborLists() {
+  double listRadiusSquared = (cutOffRadius + skin) * (cutOffRadius + skin);
+
+  neighborLists.resize(particlesVector.size());
+  for (auto &neighbors : neighborLists) neighbors.clear();
+
+  auto addIfClose = [&](size_t indexA, size_t indexB) {
+    if (dotProduct(particlesVector[indexA].getX() - particlesVector[indexB].getX()) < listRadiusSquared)
+      neighborLists[indexA].push_back(indexB);
+  };
+
+  // Same traversal as the pair loop of the linked cells container
+  for (size_t index = 0; index < cells.size(); ++index) {
+    if (cells[index].type == CellType::halo || cells[index].isEmpty()) continue;
+    for (size_t indexOffset : indexOffsetAdjacent) {
+      if (indexOffset == 0) {
+        auto &particles = cells[index].particles;
+        for (auto first = particles.begin(); first != particles.end(); ++first) {
+          for (auto second = std::next(first); second != particles.end(); ++second) addIfClose(*first, *second);
+        }
+      } else {
+        for (auto indexA : cells[index].particles) {
+          for (auto indexB : cells[index + indexOffset].particles) addIfClose(indexA, indexB);
+        }
+      }
+    }
+  }
+
+  positionsAtBuild.resize(particlesVector.size());
+  for (size_t i = 0; i < particlesVector.size(); ++i) positionsAtBuild[i] = particlesVector[i].getX();
+
+  reorderCountAtBuild = reorderCount;
+  ++rebuildCount;
+}
+
+void LinkedCellsContainerVerlet::forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) {
+  recalculateStructure();
+  applyBoundaries();
+
+  // The neighbor lists store particle indices, so the periodic pairs are not handled via ghost particles
+  if (hasPeriodicBoundaries) applyPeriodicForces(binaryFunction);
+
+  if (needsRebuild()) {
+    ScopedPhaseTimer rebuildTimer{Phase::Rebinning};
+    rebuildNeighborLists();
+  }
+
+  ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
+  for (size_t indexA = 0; indexA < neighborLists.size(); ++indexA) {
+    auto &particleA = particlesVector[indexA];
+    if (particleA.isDeleted()) continue;
+
+    for (auto indexB : neighborLists[indexA]) {
+      auto &particleB = particlesVector[indexB];
+      if (!particleB.isDeleted()) binaryFunction(particleA, particleB);
+    }
+  }
+  pairLoopTimer.stop();
+
+  for (auto &structure : structuresVector) {
+    if (structure.hasArtificalForces()) structure.applyArtificialForces();
+  }
+}
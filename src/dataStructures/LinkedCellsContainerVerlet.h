@@ -0,0 +1,61 @@
+#pragma once
+#include "LinkedCellsContainer.h"
+
+/**
+ * Linked cells container that caches the particle pairs within cut off radius + skin in per particle neighbor lists.
+ * The lists are built from the linked cells and reused as long as no particle moved further than skin / 2 since the
+ * last build, so the pairs beyond the cut off radius of the adjacent cells are only filtered on rebuilds.
+ * @note The lists are only complete if the cell size is at least cut off radius + skin.
+ */
+class LinkedCellsContainerVerlet : public LinkedCellsContainer {
+ private:
+  /// The cut off radius of the model
+  double cutOffRadius;
+
+  /// Additional distance on top of the cut off radius within which pairs are listed
+  double skin;
+
+  /// For every particle the indices of its partners with a greater position in the pair loop of the linked cells
+  std::vector<std::vector<size_t>> neighborLists;
+
+  /// The position of every particle when the neighbor lists were built
+  std::vector<std::array<double, 3>> positionsAtBuild;
+
+  /// Counts how often the neighbor lists were built
+  size_t rebuildCount{0};
+
+  /// The reorder count of the particles vector when the neighbor lists were built
+  size_t reorderCountAtBuild{0};
+
+  /**
+   * Checks whether the neighbor lists are outdated, which is the case if the particles vector was reordered or changed
+   * its size or any particle moved further than skin / 2 since the last build.
+   * @return True if the neighbor lists have to be rebuilt
+   */
+  bool needsRebuild();
+
+  /**
+   * Builds the neighbor lists by traversing the cells like the linked cells pair loop
+   */
+  void rebuildNeighborLists();
+
+ public:
+  /**
+   * Instantiating a LinkedCells Container with Verlet neighbor lists
+   * @param cellSize The edge length of a cell
+   * @param leftLowerBound The left lower corner of the domain bounding box
+   * @param rightUpperBound The right upper corner of the domain bounding box
+   * @param cutOffRadius The cut off radius of the model
+   * @param skin Additional distance on top of the cut off radius within which pairs are listed
+   */
+  LinkedCellsContainerVerlet(double cellSize, std::array<double, 3> leftLowerBound,
+                             std::array<double, 3> rightUpperBound, double cutOffRadius, double skin);
+
+  void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) override;
+
+  /**
+   * Returns how often the neighbor lists were built. ONLY USED FOR TESTING
+   * @return The number of builds
+   */
+  [[nodiscard]] size_t getRebuildCount() const { return rebuildCount; }
+};
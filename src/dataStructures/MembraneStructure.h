@@ -165,4 +165,29 @@ class MembraneStructure {
    * @return The number of particles that are part of the structure
    */
   [[nodiscard]] size_t size() const { return particleCount; }
+
+  /**
+   * @return The index of the first particle of the membrane in the particles vector
+   */
+  [[nodiscard]] size_t getStartIndex() const { return startIndex; }
+
+  /**
+   * @return The dimensions of the membrane
+   */
+  [[nodiscard]] std::array<size_t, 3> getDimensions() const { return dimensions; }
+
+  /**
+   * @return The stiffness factor of the membrane
+   */
+  [[nodiscard]] double getStiffness() const { return stiffness; }
+
+  /**
+   * @return The average bond length within the membrane
+   */
+  [[nodiscard]] double getBondLength() const { return bondLength; }
+
+  /**
+   * @return The radius at which direct and diagonal forces are applied at
+   */
+  [[nodiscard]] double getHarmonicCutOff() const { return physics.getHarmonicCutOff(); }
 };
\ No newline at end of file
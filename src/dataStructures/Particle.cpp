@@ -7,27 +7,23 @@
 
 #include "Particle.h"
 
+#include <cmath>
 #include <iostream>
 
 #include "spdlog/spdlog.h"
 #include "utils/ArrayUtils.h"
 
 Particle::Particle(int type_arg) {
-  type = type_arg;
   spdlog::trace("Particle generated!");
   x = {0.0, 0.0, 0.0};
   v = {0.0, 0.0, 0.0};
-  m = 0.0;
   f = {0., 0., 0.};
   old_f = {0., 0., 0.};
   m = 1.0;
-  epsilon = getLJEpsilon(type_arg);
-  sigma = getLJSigma(type_arg);
+  typeIndex = addType(type_arg);
   structureId = NOT_IN_STRUCTURE;
   particleId = NO_UNIQUE_ID;
   isDeleted_ = false;
-  periodicBoundariesCrossed = {0, 0, 0};
-  lastPosition = {0., 0., 0.};
 }
 
 Particle::Particle(std::array<double, 3> x_arg, std::array<double, 3> v_arg, double m_arg, int type_arg)
@@ -36,31 +32,21 @@ Particle::Particle(std::array<double, 3> x_arg, std::array<double, 3> v_arg, dou
       f{0., 0., 0.},
       old_f{0., 0., 0.},
       m(m_arg),
-      type(type_arg),
-      epsilon{getLJEpsilon(type_arg)},
-      sigma{getLJSigma(type_arg)},
-      periodicBoundariesCrossed{0, 0, 0},
-      isDeleted_{false},
+      typeIndex{addType(type_arg)},
       structureId{NOT_IN_STRUCTURE},
       particleId{NO_UNIQUE_ID},
-      lastPosition{0., 0., 0.} {
+      isDeleted_{false} {
   spdlog::trace("Particle generated!");
 }
 
-Particle::~Particle() { spdlog::trace("Particle destructed!"); }
-
-double Particle::getM() const { return m; }
-
-int Particle::getType() const { return type; }
-
 std::string Particle::toString() const {
   std::stringstream stream;
-  stream << "Particle: X:" << x << " v: " << v << " f: " << f << " old_f: " << old_f << " type: " << type;
+  stream << "Particle: X:" << x << " v: " << v << " f: " << f << " old_f: " << old_f << " type: " << getType();
   return stream.str();
 }
 
 bool Particle::operator==(Particle &other) {
-  return (x == other.x) and (v == other.v) and (f == other.f) and (type == other.type) and (m == other.m) and
+  return (x == other.x) and (v == other.v) and (f == other.f) and (typeIndex == other.typeIndex) and (m == other.m) and
          (old_f == other.old_f);
 }
 
@@ -81,13 +67,40 @@ void Particle::registerParticleType(int type, double epsilon, double sigma) {
   }
 
   typeToParametersMap.insert({type, ParticleType{epsilon, sigma}});
+  typeParameters[addType(type)] = {epsilon, sigma};
+  updatePairParameters();
 }
 
-Particle::ParticleType Particle::getLJParticleType(int type) {
-  constexpr ParticleType DEFAULT{5.0, 1.0};
+void Particle::restoreParticleType(int type, double epsilon, double sigma) {
+  if (typeToParametersMap.contains(type)) return;
+
+  auto &parameters = typeParameters[addType(type)];
+  if (parameters.epsilon != epsilon || parameters.sigma != sigma) registerParticleType(type, epsilon, sigma);
+}
 
-  auto searchResult = typeToParametersMap.find(type);
-  return (searchResult == typeToParametersMap.end()) ? DEFAULT : searchResult->second;
+std::uint32_t Particle::addType(int type) {
+  auto searchResult = typeIndices.find(type);
+  if (searchResult != typeIndices.end()) return searchResult->second;
+
+  auto index = static_cast<std::uint32_t>(types.size());
+  typeIndices.insert({type, index});
+  types.push_back(type);
+  typeParameters.push_back(DEFAULT_TYPE);
+  updatePairParameters();
+  return index;
+}
+
+void Particle::updatePairParameters() {
+  pairParameters.resize(typeParameters.size() * typeParameters.size());
+  for (size_t i = 0; i < typeParameters.size(); ++i) {
+    for (size_t j = 0; j < typeParameters.size(); ++j) {
+      auto &p1 = typeParameters[i];
+      auto &p2 = typeParameters[j];
+      double epsilon = p1.epsilon == p2.epsilon ? p1.epsilon : std::sqrt(p1.epsilon * p2.epsilon);
+      double sigma = p1.sigma == p2.sigma ? p1.sigma : (p1.sigma + p2.sigma) / 2;
+      pairParameters[i * typeParameters.size() + j] = {24 * epsilon, sigma * sigma, epsilon, sigma};
+    }
+  }
 }
 
 void Particle::applySymmetricForce(Particle &partner, const std::array<double, 3> &force) {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #define NOT_IN_STRUCTURE 0xffffffff
@@ -19,9 +20,22 @@ class NewtonsLawModel;
 class LennardJonesModel;
 class Thermostat;
 class LineProcessorCheckpoint;
+class CheckpointBinaryReader;
 class MembraneStructure;
 class SmoothedLennardJonesModel;
 
+/**
+ * The part of a particle that is only needed by the statistics. It is kept apart from the particles, so that the pair
+ * loops do not have to move it through the caches.
+ */
+struct ParticleHistory {
+  /// The position of the particle at the last measurement of the statistics
+  std::array<double, 3> lastPosition{0., 0., 0.};
+
+  /// Counts how many times the particle crossed a periodic boundary per dimension since the last measurement
+  std::array<int, 3> periodicBoundariesCrossed{0, 0, 0};
+};
+
 class Particle {
  private:
   /**
@@ -50,25 +64,16 @@ class Particle {
   double m;
 
   /**
-   * Type of the particle. Use it for whatever you want (e.g. to separate
-   * molecules belonging to different bodies, matters, and so on)
-   */
-  int type;
-
-  /**
-   * Lennard Jones depth of potential well
+   * Index of the type of the particle into the type tables. The type itself can be used for whatever you want (e.g. to
+   * separate molecules belonging to different bodies, matters, and so on) and determines the Lennard-Jones parameters.
    */
-  double epsilon;
+  std::uint32_t typeIndex;
 
-  /**
-   * Lennard Jones distance at which particle-particle potential energy is 0 / size of the particle
-   */
-  double sigma;
+  /// The id or index of the structure the particle is a member of. -1 if not set.
+  std::uint32_t structureId;
 
-  /**
-   * Counts how many times a periodic boun
-   */
-  std::array<int, 3> periodicBoundariesCrossed;
+  /// The id or index of the particle. -1 if not set.
+  std::uint32_t particleId;
 
   /**
    * Is true when a particle no longer is part of the simulation and waits for
@@ -76,46 +81,67 @@ class Particle {
    */
   bool isDeleted_;
 
-  /// The id or index of the structure the particle is a member of. -1 if not set.
-  size_t structureId;
-
-  /// The id or index of the particle. -1 if not set.
-  size_t particleId;
-
+ public:
+  /// The Lennard-Jones parameters registered for a particle type
   struct ParticleType {
-    double const epsilon;
-    double const sigma;
+    double epsilon;
+    double sigma;
   };
 
   /**
-   * Maps the position of the Particle at a particular time
+   * The Lennard-Jones parameters of a pair of particle types, mixed with the Lorentz-Berthelot rules. Besides the
+   * parameters themselves it holds the constants the force kernels need, so that they do not have to mix the
+   * parameters on every interaction.
    */
+  struct PairParameters {
+    /// 24 * epsilon
+    double epsilon24;
+    /// sigma²
+    double sigmaSquared;
+    /// Mixed epsilon (Lorentz-Berthelot), only read by the potential and the checkpoint writer
+    double epsilon;
+    /// Mixed sigma, only read by the potential and the checkpoint writer
+    double sigma;
+  };
 
-  std::array<double, 3> lastPosition;
-
- public:
  private:
+  /// The explicitly registered particle types
   static inline std::unordered_map<int, ParticleType> typeToParametersMap{};
 
-  /**
-   * Get the ParticleType containing the Lennard-Jones parameters.
-   * @param type The integer type a ParticleType was registered for
-   * @return ParticleType containing the epsilon and sigma for the particle.
-   * Returns the default values epsilon=5.0 and sigma=1.0 when the type is not registered.
+  /// The Lennard-Jones parameters of types that are not registered explicitly
+  static constexpr ParticleType DEFAULT_TYPE{5.0, 1.0};
+
+  /*
+   * The default type 0 is in the type tables from the start, so that constructing particles of it never modifies the
+   * tables, e.g. ghost particles within a parallel loop
    */
-  ParticleType getLJParticleType(int type);
+
+  /// Maps each type in use to its index into the type tables
+  static inline std::unordered_map<int, std::uint32_t> typeIndices{{0, 0}};
+
+  /// The type of each type index
+  static inline std::vector<int> types{0};
+
+  /// The Lennard-Jones parameters of each type index
+  static inline std::vector<ParticleType> typeParameters{DEFAULT_TYPE};
+
+  /// The mixed Lennard-Jones parameters of each pair of type indices, row by row
+  static inline std::vector<PairParameters> pairParameters{
+      {24 * DEFAULT_TYPE.epsilon, DEFAULT_TYPE.sigma * DEFAULT_TYPE.sigma, DEFAULT_TYPE.epsilon, DEFAULT_TYPE.sigma}};
 
   /**
-   * @param type Integer type of particle
-   * @return Lennard Jones depth of potential well
+   * Get the index of a type into the type tables. Types that are not in the tables yet are added with the default
+   * values epsilon=5.0 and sigma=1.0. Adding a type resizes the tables, so this must not run concurrently to the force
+   * calculation. Particles of new types are therefore only to be created while setting up the simulation.
+   * @param type The integer type of a particle
+   * @return The index of the type
    */
-  double getLJEpsilon(int type) { return getLJParticleType(type).epsilon; }
+  static std::uint32_t addType(int type);
 
   /**
-   * @param type Integer type of particle
-   * @return Sigma parameter aka. size of particle
+   * Recalculates the mixed parameters of all pairs of type indices
    */
-  double getLJSigma(int type) { return getLJParticleType(type).sigma; }
+  static void updatePairParameters();
 
  public:
   explicit Particle(int type = 0);
@@ -128,7 +154,7 @@ class Particle {
       // -> in case of 2d, we use only the first and the second
       std::array<double, 3> x_arg, std::array<double, 3> v_arg = {0.0, 0.0, 0.0}, double m_arg = 1.0, int type = 0);
 
-  virtual ~Particle();
+  ~Particle() = default;
 
   const std::array<double, 3> &getX() const { return x; }
 
@@ -138,19 +164,20 @@ class Particle {
 
   const std::array<double, 3> &getOldF() const { return old_f; }
 
-  const std::array<double, 3> &getLastPosition() const { return lastPosition; }
-
-  std::array<int, 3> &getPeriodicBoundariesCrossed() { return periodicBoundariesCrossed; }
-
   void setX(std::array<double, 3> const &x_arg) { x = x_arg; }
 
-  double getM() const;
+  double getM() const { return m; }
 
-  int getType() const;
+  int getType() const { return types[typeIndex]; }
 
-  double getEpsilon() const { return epsilon; };
+  /**
+   * @return The index of the type of the particle into the type tables
+   */
+  std::uint32_t getTypeIndex() const { return typeIndex; }
+
+  double getEpsilon() const { return typeParameters[typeIndex].epsilon; };
 
-  double getSigma() const { return sigma; };
+  double getSigma() const { return typeParameters[typeIndex].sigma; };
 
   bool operator==(Particle &other);
 
@@ -165,6 +192,7 @@ class Particle {
   friend class Thermostat;
   friend class Simulation;
   friend class LineProcessorCheckpoint;
+  friend class CheckpointBinaryReader;
 
   /**
    * Move current forces on particle to old_f and set f to 0-vector so we can
@@ -185,13 +213,51 @@ class Particle {
 
   /**
    * Registers a new particle type. This is used to ensure that each particle of the same type, gets the same
-   * Lennard-Jones parameters.
+   * Lennard-Jones parameters. Particles of the type that were created before with the default parameters get the
+   * registered parameters as well.
    * @param type Type for which Lennard-Jones parameters get registered
    * @param epsilon Lennard-Jones epsilon parameter
    * @param sigma Lennard-Jones sigma parameter
    */
   static void registerParticleType(int type, double epsilon, double sigma);
 
+  /**
+   * Registers the parameters of a type that were read from a checkpoint, unless the type was registered before or the
+   * parameters are the defaults anyway.
+   * @param type Type for which Lennard-Jones parameters get registered
+   * @param epsilon Lennard-Jones epsilon parameter
+   * @param sigma Lennard-Jones sigma parameter
+   */
+  static void restoreParticleType(int type, double epsilon, double sigma);
+
+  /**
+   * @return All particle types registered so far, mapped to their Lennard-Jones parameters
+   */
+  static const std::unordered_map<int, ParticleType> &getRegisteredParticleTypes() { return typeToParametersMap; }
+
+  /**
+   * @return The number of types in use, the type indices of all particles are smaller
+   */
+  static std::uint32_t getTypeCount() { return static_cast<std::uint32_t>(types.size()); }
+
+  /**
+   * @param typeIndex1 The type index of the first particle
+   * @param typeIndex2 The type index of the second particle
+   * @return The mixed Lennard-Jones parameters of a pair of particles
+   */
+  static const PairParameters &getPairParameters(std::uint32_t typeIndex1, std::uint32_t typeIndex2) {
+    return pairParameters[typeIndex1 * types.size() + typeIndex2];
+  }
+
+  /**
+   * @param typeIndex The type index of a particle
+   * @return The mixed Lennard-Jones parameters of the particle with each type index, indexed by the type index of the
+   * partner
+   */
+  static const PairParameters *getPairParametersRow(std::uint32_t typeIndex) {
+    return &pairParameters[typeIndex * types.size()];
+  }
+
   /**
    * Adds force to the particle and subtracts force from partner particle.
    * Implements Newtons Third law.
@@ -212,12 +278,12 @@ class Particle {
    * Sets the structure membership of the current particle
    * @param structureId_ The structure the particle is a member of
    */
-  void setStructure(size_t structureId_) { structureId = structureId_; }
+  void setStructure(size_t structureId_) { structureId = static_cast<std::uint32_t>(structureId_); }
 
   /**
    * @return The structure the particle is part of
    */
-  size_t getStructure() { return structureId; }
+  size_t getStructure() const { return structureId; }
 
   /**
    * @return Whether the particle is member of a structure
@@ -229,14 +295,12 @@ class Particle {
    * @param id Id of particle
    * @note This is used for the membrane
    */
-  void setId(size_t id) { particleId = id; }
+  void setId(size_t id) { particleId = static_cast<std::uint32_t>(id); }
 
   /**
    * @return Id of particle
    */
   size_t getId() const { return particleId; }
-
-  void setLastPosition(const std::array<double, 3> &lp) { this->lastPosition = lp; }
 };
 
 std::ostream &operator<<(std::ostream &stream, Particle &p);
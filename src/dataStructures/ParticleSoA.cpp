@@ -0,0 +1,34 @@
+#include "ParticleSoA.h"
+
+#include <algorithm>
+
+void ParticleSoA::resize(size_t count) {
+  for (auto *array : {&x, &y, &z, &fx, &fy, &fz, &m}) array->resize(count);
+  typeIndex.resize(count);
+}
+
+void ParticleSoA::set(size_t index, Particle const &p) {
+  x[index] = p.getX()[0];
+  y[index] = p.getX()[1];
+  z[index] = p.getX()[2];
+  m[index] = p.getM();
+  typeIndex[index] = p.getTypeIndex();
+}
+
+void ParticleSoA::resetForces() {
+  std::fill(fx.begin(), fx.end(), 0.);
+  std::fill(fy.begin(), fy.end(), 0.);
+  std::fill(fz.begin(), fz.end(), 0.);
+}
+
+void ParticleSoA::load(std::vector<Particle> const &particles, std::vector<size_t> const &order) {
+  resize(order.size());
+  for (size_t i = 0; i < order.size(); ++i) set(i, particles[order[i]]);
+  resetForces();
+}
+
+void ParticleSoA::storeForces(std::vector<Particle> &particles, std::vector<size_t> const &order) const {
+  for (size_t i = 0; i < order.size(); ++i) {
+    particles[order[i]].applyForce({fx[i], fy[i], fz[i]});
+  }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Particle.h"
+
+/**
+ * Structure of arrays representation of a particle vector. Only the attributes read by the force calculation are
+ * copied in, each into its own contiguous array, and only the forces are copied back out, so that pair loops only pull
+ * the attributes they actually read through the cache. The particles are loaded in a given order, e.g. sorted by cell.
+ */
+class ParticleSoA {
+ public:
+  /// Positions of the particles
+  std::vector<double> x, y, z;
+
+  /// Forces that were accumulated on the particles since the last load
+  std::vector<double> fx, fy, fz;
+
+  /// Masses of the particles
+  std::vector<double> m;
+
+  /// Type indices of the particles, which select their Lennard-Jones parameters
+  std::vector<std::uint32_t> typeIndex;
+
+  /**
+   * Mirrors the particles into the arrays in the given order. The force arrays are set to zero, so that afterwards they
+   * only contain the forces that were added to the structure of arrays.
+   * @param particles The particles that get mirrored
+   * @param order The index in the particles vector of each entry of the arrays
+   * @note Memory is only allocated when the particle count grows, so this can be called every iteration.
+   */
+  void load(std::vector<Particle> const &particles, std::vector<size_t> const &order);
+
+  /**
+   * Adds the forces accumulated in the arrays onto the particles they were loaded from.
+   * @param particles The particles the arrays were loaded from
+   * @param order The order the particles were loaded in
+   */
+  void storeForces(std::vector<Particle> &particles, std::vector<size_t> const &order) const;
+
+  /**
+   * @return The number of particles in the arrays
+   */
+  [[nodiscard]] size_t size() const { return x.size(); }
+
+ private:
+  /**
+   * Changes the size of all arrays
+   * @param count The new number of particles
+   */
+  void resize(size_t count);
+
+  /**
+   * Copies the attributes of a particle into the arrays
+   * @param index The index in the arrays
+   * @param p The particle
+   */
+  void set(size_t index, Particle const &p);
+
+  /**
+   * Sets all forces in the arrays to zero
+   */
+  void resetForces();
+};
@@ -8,6 +8,7 @@
 #include "IContainer.h"
 #include "Particle.h"
 #include "utils/ArrayUtils.h"
+#include "utils/PhaseTimers.h"
 
 /**  \image html runtime-directsum.png width=900px
  *    \image latex runtime-directsum.png "Runtime" width = [goodwidth]cm
@@ -22,18 +23,55 @@ class VectorContainer : public IContainer {
     }
   }
 
+#ifdef _OPENMP
+  void forEachParallel(std::function<void(Particle &)> &unaryFunction) override {
+#pragma omp parallel for default(none) shared(unaryFunction) schedule(static)
+    for (size_t i = 0; i < vector.size(); ++i) {
+      unaryFunction(vector[i]);
+    }
+  }
+
+  double reduceSum(std::function<double(Particle &)> &unaryFunction) override {
+    double sum{0.};
+#pragma omp parallel for default(none) shared(unaryFunction) reduction(+ : sum) schedule(static)
+    for (size_t i = 0; i < vector.size(); ++i) {
+      sum += unaryFunction(vector[i]);
+    }
+    return sum;
+  }
+#endif
+
   void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) override {
+    ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
     for (size_t i = 0; i < size(); ++i) {
       for (size_t j = i + 1; j < size(); ++j) {
         binaryFunction(vector[i], vector[j]);
       }
     }
+    pairLoopTimer.stop();
 
     for (auto &structure : structuresVector) {
       if (structure.hasArtificalForces()) structure.applyArtificialForces();
     }
   }
 
+  /**
+   * Applies the model to all particle pairs like forEachPair, but calls the force calculation of the concrete model
+   * directly instead of via std::function and the virtual addForces, so that it can be inlined into the loop.
+   * @tparam Model The concrete type of the model
+   * @param model The model that calculates the forces between two particles
+   * @note Structures are not supported, since the pairs within structures need their own force calculation
+   */
+  template <typename Model>
+  void forEachPairWithModel(Model const &model) {
+    ScopedPhaseTimer timer{Phase::PairLoop};
+    for (size_t i = 0; i < vector.size(); ++i) {
+      for (size_t j = i + 1; j < vector.size(); ++j) {
+        model.Model::addForces(vector[i], vector[j]);
+      }
+    }
+  }
+
   size_t size() override { return vector.size(); }
 
   size_t capacity() override { return vector.capacity(); }
@@ -42,12 +80,14 @@ class VectorContainer : public IContainer {
 
   void emplace_back(std::array<double, 3> x_arg, std::array<double, 3> v_arg, double m_arg, int type) override {
     vector.emplace_back(x_arg, v_arg, m_arg, type);
-    vector.back().setId(vector.size() - 1);
+    vector.back().setId(histories.size());
+    histories.emplace_back();
   };
 
   void push_back(Particle &particle) override {
     vector.push_back(std::forward<Particle &>(particle));
-    vector.back().setId(vector.size() - 1);
+    vector.back().setId(histories.size());
+    histories.emplace_back();
   }
 
   void push_back(MembraneStructure membrane) override {
@@ -59,6 +99,8 @@ class VectorContainer : public IContainer {
 
   [[nodiscard]] std::vector<Particle> &getParticlesRef() override { return getVector(); }
 
+  ParticleHistory &getHistory(const Particle &particle) override { return histories.at(particle.getId()); }
+
   /**
    * @return True if the container has structures
    */
@@ -74,6 +116,9 @@ class VectorContainer : public IContainer {
   /// The vector containing all the particles
   std::vector<Particle> vector{};
 
+  /// The histories of the particles, indexed by their id
+  std::vector<ParticleHistory> histories{};
+
   /// The vector containing all structures. (Only membranes for now, worksheet 5)
   std::vector<MembraneStructure> structuresVector;
 };
@@ -1,4 +1,7 @@
 #pragma once
+#include <algorithm>
+
+#include "LoadImbalanceStatistics.h"
 #include "dataStructures/LinkedCellsContainer.h"
 
 /**
@@ -6,6 +9,8 @@
  * Each colour is a vector of an array of cell indices, which are arranged that no neighbouring cell of such an array
  * block is overlapping with an other array block. To achieve this 8 colours were used. One thread therefore always has
  * to work in a block of 4 cells.
+ * Before each force calculation the blocks of each colour are sorted by their number of particle pairs, so that the
+ * most expensive blocks are handed out first.
  *  \image html colouringMultiple.gif width=900px
  *  \image latex colouringMultiple.gif "Colouring schema" width = [goodwidth]cm
  */
@@ -18,10 +23,55 @@ class LinkedCellsContainerColouringMultiple : public LinkedCellsContainer {
    */
   std::vector<std::vector<std::array<size_t, 4>>> colourList{};
 
+  /// The load imbalance of each colour, measured while the phase timers are enabled. Sized by the constructor once the
+  /// colours are built.
+  LoadImbalanceStatistics loadStatistics{0, "Colour"};
+
+  /// The estimated cost of each cell of the colours, 0 for halo cells, updated before each force calculation
+  std::vector<std::uint64_t> cellCosts{};
+
+  /// The number of blocks at the front of each sorted colour that have any particle pairs
+  std::vector<size_t> busyGroupCounts{};
+
+#ifdef _OPENMP
+  /**
+   * @param colourGroup A block of cells
+   * @return The summed cost of the cells of the block
+   */
+  [[nodiscard]] std::uint64_t getGroupCost(const std::array<size_t, 4> &colourGroup) const {
+    return cellCosts[colourGroup[0]] + cellCosts[colourGroup[1]] + cellCosts[colourGroup[2]] +
+           cellCosts[colourGroup[3]];
+  }
+
+  /**
+   * Estimates the cost of each cell by its number of particle pairs and sorts the blocks of each colour by descending
+   * cost. Blocks without pairs end up behind the busy blocks and are skipped by the force calculation.
+   */
+  void sortColoursByCost() {
+    cellCosts.resize(cells.size());
+    busyGroupCounts.resize(colourList.size());
+#pragma omp parallel for default(none) schedule(dynamic, 1)
+    for (size_t colourIndex = 0; colourIndex < colourList.size(); ++colourIndex) {
+      auto &colour = colourList[colourIndex];
+      for (auto &colourGroup : colour) {
+        for (auto index : colourGroup) {
+          cellCosts[index] = cells[index].type == CellType::halo ? 0 : estimateCellPairCost(index);
+        }
+      }
+      std::sort(colour.begin(), colour.end(),
+                [this](auto &a, auto &b) { return getGroupCost(a) > getGroupCost(b); });
+      auto busyEnd = std::partition_point(colour.begin(), colour.end(),
+                                          [this](auto &colourGroup) { return getGroupCost(colourGroup) > 0; });
+      busyGroupCounts[colourIndex] = busyEnd - colour.begin();
+    }
+  }
+#endif
+
  public:
   LinkedCellsContainerColouringMultiple(double cellSize, std::array<double, 3> &leftLowerBound,
                                         std::array<double, 3> &rightUpperBound)
       : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound) {
+    parallelUpdates = true;
     for (int i = 0; i < 8; ++i) {
       colourList.emplace_back();
     }
@@ -40,48 +90,60 @@ class LinkedCellsContainerColouringMultiple : public LinkedCellsContainer {
         }
       }
     }
+    loadStatistics.setPassCount(colourList.size());
   }
 #ifdef _OPENMP
 
   void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) override {
     recalculateStructure();
     applyBoundaries();
+    if (hasPeriodicBoundaries) createGhostParticles();
 
-    if (hasPeriodicBoundaries) {
-      recalculateStructure();
-      applyPeriodicForces(binaryFunction);
-    }
+    ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
+    sortColoursByCost();
+    for (size_t colourIndex = 0; colourIndex < colourList.size(); ++colourIndex) {
+      auto &colour = colourList[colourIndex];
+      auto passStart = LoadImbalanceStatistics::beginPass();
+#pragma omp parallel default(none) shared(binaryFunction, cells, colour, colourIndex)
+      {
+        // The event of each thread ends when it runs out of colour groups, not at the barrier of the region
+        ScopedTraceEvent colourEvent{"Colour pass", static_cast<int>(colourIndex)};
+        LoadImbalanceStatistics::ThreadWork work{loadStatistics};
+#pragma omp for schedule(dynamic, 1) nowait
+        for (size_t position = 0; position < busyGroupCounts[colourIndex]; ++position) {
+          for (auto index : colour[position]) {
+            if (cellCosts[index] == 0) continue;
 
-    for (auto &colour : colourList) {
-#pragma omp parallel for default(none) shared(binaryFunction, cells, colour) schedule(guided)
-      for (auto &colourGroup : colour) {
-        for (auto index : colourGroup) {
-          if (cells[index].type == CellType::halo || cells[index].isEmpty()) {
-            continue;
-          }
-          for (size_t indexOffset : indexOffsetAdjacent) {
-            // Special case to match particles within one cell
-            if (indexOffset == 0) {
-              auto &particles = cells[index].particles;
-              for (auto first = particles.begin(); first != particles.end(); ++first) {
-                for (auto second = std::next(first); second != particles.end(); ++second) {
-                  binaryFunction(particlesVector[*first], particlesVector[*second]);
+            work.pairs += cellCosts[index];
+            for (size_t indexOffset : indexOffsetAdjacent) {
+              // Special case to match particles within one cell
+              if (indexOffset == 0) {
+                auto &particles = cells[index].particles;
+                for (auto first = particles.begin(); first != particles.end(); ++first) {
+                  for (auto second = std::next(first); second != particles.end(); ++second) {
+                    binaryFunction(particlesVector[*first], particlesVector[*second]);
+                  }
                 }
-              }
 
-            } else {
-              // Loop so the particles of each of the two cells and match them
-              for (auto indexA : cells[index].particles) {
-                for (auto indexB : cells[index + indexOffset].particles) {
-                  binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+              } else {
+                // Loop so the particles of each of the two cells and match them
+                for (auto indexA : cells[index].particles) {
+                  for (auto indexB : cells[index + indexOffset].particles) {
+                    binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+                  }
                 }
               }
             }
           }
         }
       }
+      loadStatistics.endPass(colourIndex, passStart);
     }
 
+    pairLoopTimer.stop();
+
+    if (hasPeriodicBoundaries) removeGhostParticles();
+
     for (auto &structure : structuresVector) {
       if (structure.hasArtificalForces()) structure.applyArtificialForces();
     }
@@ -89,4 +151,6 @@ class LinkedCellsContainerColouringMultiple : public LinkedCellsContainer {
 
   [[nodiscard]] const std::vector<std::vector<std::array<size_t, 4>>> &getColourList() const { return colourList; }
 #endif
+
+  LoadImbalanceStatistics *getLoadImbalanceStatistics() override { return &loadStatistics; }
 };
@@ -1,10 +1,15 @@
 #pragma once
+#include <algorithm>
+
+#include "LoadImbalanceStatistics.h"
 #include "dataStructures/LinkedCellsContainer.h"
 
 /**
  * Uses domain colouring to ensure that no race conditions can occur
  * Each colour is a vector of cell indices, which are arranged that no neighbouring cell is overlapping
  * To achieve this 18 colours were used
+ * Before each force calculation the cells of each colour are sorted by their number of particle pairs, so that the
+ * threads take the most expensive cells first and the cheap ones balance the end of each colour
  *  \image html colouringSingle.gif width=900px
  *  \image latex colouringSingle.gif "Colouring schema" width = [goodwidth]cm
  */
@@ -17,10 +22,41 @@ class LinkedCellsContainerColouringSingle : public LinkedCellsContainer {
    */
   std::vector<std::vector<size_t>> colourList{};
 
+  /// The load imbalance of each colour, measured while the phase timers are enabled. Sized by the constructor once the
+  /// colours are built.
+  LoadImbalanceStatistics loadStatistics{0, "Colour"};
+
+  /// The estimated cost of each cell of the colours, updated before each force calculation
+  std::vector<std::uint64_t> cellCosts{};
+
+  /// The number of cells at the front of each sorted colour that have any particle pairs
+  std::vector<size_t> busyCellCounts{};
+
+#ifdef _OPENMP
+  /**
+   * Estimates the cost of each cell by its number of particle pairs and sorts the cells of each colour by descending
+   * cost. Cells without pairs end up behind the busy cells and are skipped by the force calculation.
+   */
+  void sortColoursByCost() {
+    cellCosts.resize(cells.size());
+    busyCellCounts.resize(colourList.size());
+#pragma omp parallel for default(none) schedule(dynamic, 1)
+    for (size_t colourIndex = 0; colourIndex < colourList.size(); ++colourIndex) {
+      auto &colour = colourList[colourIndex];
+      for (auto index : colour) cellCosts[index] = estimateCellPairCost(index);
+      std::sort(colour.begin(), colour.end(), [this](size_t a, size_t b) { return cellCosts[a] > cellCosts[b]; });
+      auto busyEnd =
+          std::partition_point(colour.begin(), colour.end(), [this](size_t index) { return cellCosts[index] > 0; });
+      busyCellCounts[colourIndex] = busyEnd - colour.begin();
+    }
+  }
+#endif
+
  public:
   LinkedCellsContainerColouringSingle(double cellSize, std::array<double, 3> &leftLowerBound,
                                       std::array<double, 3> &rightUpperBound)
       : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound) {
+    parallelUpdates = true;
     for (int i = 0; i < 18; ++i) {
       colourList.emplace_back();
     }
@@ -37,46 +73,58 @@ class LinkedCellsContainerColouringSingle : public LinkedCellsContainer {
         }
       }
     }
+    loadStatistics.setPassCount(colourList.size());
   }
 
 #ifdef _OPENMP
   void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) override {
     recalculateStructure();
     applyBoundaries();
+    if (hasPeriodicBoundaries) createGhostParticles();
 
-    if (hasPeriodicBoundaries) {
-      recalculateStructure();
-      applyPeriodicForces(binaryFunction);
-    }
-
-    for (auto &colour : colourList) {
-#pragma omp parallel for default(none) shared(binaryFunction, cells, colour) schedule(guided)
-      for (auto index : colour) {
-        if (cells[index].type == CellType::halo || cells[index].isEmpty()) {
-          continue;
-        }
-        for (size_t indexOffset : indexOffsetAdjacent) {
-          // Special case to match particles within one cell
-          if (indexOffset == 0) {
-            auto &particles = cells[index].particles;
-            for (auto first = particles.begin(); first != particles.end(); ++first) {
-              for (auto second = std::next(first); second != particles.end(); ++second) {
-                binaryFunction(particlesVector[*first], particlesVector[*second]);
+    ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
+    sortColoursByCost();
+    for (size_t colourIndex = 0; colourIndex < colourList.size(); ++colourIndex) {
+      auto &colour = colourList[colourIndex];
+      auto passStart = LoadImbalanceStatistics::beginPass();
+#pragma omp parallel default(none) shared(binaryFunction, cells, colour, colourIndex)
+      {
+        // Ends before the barrier of the region, so the trace shows the imbalance between the threads
+        ScopedTraceEvent colourEvent{"Colour pass", static_cast<int>(colourIndex)};
+        LoadImbalanceStatistics::ThreadWork work{loadStatistics};
+        // The cells are sorted by descending cost, so handing them out one by one schedules the heaviest first
+#pragma omp for schedule(dynamic, 1) nowait
+        for (size_t position = 0; position < busyCellCounts[colourIndex]; ++position) {
+          size_t index = colour[position];
+          work.pairs += cellCosts[index];
+          for (size_t indexOffset : indexOffsetAdjacent) {
+            // Special case to match particles within one cell
+            if (indexOffset == 0) {
+              auto &particles = cells[index].particles;
+              for (auto first = particles.begin(); first != particles.end(); ++first) {
+                for (auto second = std::next(first); second != particles.end(); ++second) {
+                  binaryFunction(particlesVector[*first], particlesVector[*second]);
+                }
               }
-            }
 
-          } else {
-            // Loop so the particles of each of the two cells and match them
-            for (auto indexA : cells[index].particles) {
-              for (auto indexB : cells[index + indexOffset].particles) {
-                binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+            } else {
+              // Loop so the particles of each of the two cells and match them
+              for (auto indexA : cells[index].particles) {
+                for (auto indexB : cells[index + indexOffset].particles) {
+                  binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+                }
               }
             }
           }
         }
       }
+      loadStatistics.endPass(colourIndex, passStart);
     }
 
+    pairLoopTimer.stop();
+
+    if (hasPeriodicBoundaries) removeGhostParticles();
+
     for (auto &structure : structuresVector) {
       if (structure.hasArtificalForces()) structure.applyArtificialForces();
     }
@@ -85,4 +133,6 @@ class LinkedCellsContainerColouringSingle : public LinkedCellsContainer {
   // For testing purposes
   const std::vector<std::vector<size_t>> &getColourList() const { return colourList; }
 #endif
+
+  LoadImbalanceStatistics *getLoadImbalanceStatistics() override { return &loadStatistics; }
 };
@@ -0,0 +1,131 @@
+#pragma once
+#include "dataStructures/LinkedCellsContainer.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/// How the per thread force buffers are added onto the particles
+enum class ForceBufferReduction {
+  /// Each particle sums up its entries of all buffers at once
+  Full,
+  /// The particles are split into blocks and the buffers are added block by block, so each buffer is read linearly
+  Blocked
+};
+
+/**
+ * Processes the cells in parallel without locks. Each pair is only calculated once: the thread owning the base cell
+ * adds the force onto the particle of the base cell directly, since no other thread writes to it, and the reaction
+ * force onto the particle of the neighboring cell into its private force buffer. After the pair loop the buffers are
+ * reduced onto the particles.
+ */
+class LinkedCellsContainerForceBuffer : public LinkedCellsContainer {
+ private:
+  /// The way the buffers are reduced
+  ForceBufferReduction reduction;
+
+  /// One buffer per thread, holding the reaction forces of each particle
+  std::vector<std::vector<std::array<double, 3>>> forceBuffers{};
+
+  /// The number of particles per block of the blocked reduction
+  static constexpr size_t reductionBlockSize = 1024;
+
+ public:
+  LinkedCellsContainerForceBuffer(double cellSize, std::array<double, 3> &leftLowerBound,
+                                  std::array<double, 3> &rightUpperBound,
+                                  ForceBufferReduction reduction = ForceBufferReduction::Blocked)
+      : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound), reduction{reduction} {
+    parallelUpdates = true;
+  }
+
+#ifdef _OPENMP
+  /**
+   * Applies the model to all particle pairs in parallel, using the force buffers for the reaction forces.
+   * @param model The model that calculates the forces between two particles
+   * @param binaryFunction Used for periodic boundaries and as a fallback when the container holds structures
+   */
+  void applyForceModel(IModel &model, std::function<void(Particle &, Particle &)> &binaryFunction) override {
+    // Pairs within structures need their own force calculation, which is only available via binaryFunction
+    if (containsStructures()) {
+      forEachPair(binaryFunction);
+      return;
+    }
+
+    recalculateStructure();
+    applyBoundaries();
+    if (hasPeriodicBoundaries) createGhostParticles();
+
+    // Entries are zero after each reduction, so only new entries have to be initialized
+    ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
+    forceBuffers.resize(omp_get_max_threads());
+    for (auto &buffer : forceBuffers) buffer.resize(particlesVector.size(), {0., 0., 0.});
+
+#pragma omp parallel default(none) shared(model, cells)
+    {
+      auto &buffer = forceBuffers[omp_get_thread_num()];
+
+#pragma omp for schedule(guided)
+      for (size_t index = 0; index < cells.size(); ++index) {
+        if (cells[index].type == CellType::halo || cells[index].isEmpty()) continue;
+
+        for (size_t indexOffset : indexOffsetAdjacent) {
+          // Both particles belong to the base cell, so both can be written directly
+          if (indexOffset == 0) {
+            auto &particles = cells[index].particles;
+            for (auto first = particles.begin(); first != particles.end(); ++first) {
+              for (auto second = std::next(first); second != particles.end(); ++second) {
+                model.addForces(particlesVector[*first], particlesVector[*second]);
+              }
+            }
+          } else {
+            for (auto indexA : cells[index].particles) {
+              auto &particleA = particlesVector[indexA];
+              for (auto indexB : cells[index + indexOffset].particles) {
+                auto force = model.calculateForce(particleA, particlesVector[indexB]);
+                particleA.applyForce(force);
+                buffer[indexB] = buffer[indexB] - force;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    reduceForceBuffers();
+    pairLoopTimer.stop();
+
+    if (hasPeriodicBoundaries) removeGhostParticles();
+  }
+
+ private:
+  /**
+   * Adds the forces of all buffers onto the particles and resets the buffers
+   */
+  void reduceForceBuffers() {
+    size_t particleCount = particlesVector.size();
+
+    if (reduction == ForceBufferReduction::Full) {
+#pragma omp parallel for default(none) shared(particleCount) schedule(static)
+      for (size_t i = 0; i < particleCount; ++i) {
+        std::array<double, 3> force{0., 0., 0.};
+        for (auto &buffer : forceBuffers) {
+          force = force + buffer[i];
+          buffer[i] = {0., 0., 0.};
+        }
+        particlesVector[i].applyForce(force);
+      }
+      return;
+    }
+
+#pragma omp parallel for default(none) shared(particleCount) schedule(static)
+    for (size_t blockStart = 0; blockStart < particleCount; blockStart += reductionBlockSize) {
+      size_t blockEnd = std::min(blockStart + reductionBlockSize, particleCount);
+      for (auto &buffer : forceBuffers) {
+        for (size_t i = blockStart; i < blockEnd; ++i) {
+          particlesVector[i].applyForce(buffer[i]);
+          buffer[i] = {0., 0., 0.};
+        }
+      }
+    }
+  }
+#endif
+};
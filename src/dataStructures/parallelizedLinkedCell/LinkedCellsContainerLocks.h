@@ -1,52 +1,68 @@
 #pragma once
+#include "LoadImbalanceStatistics.h"
 #include "dataStructures/LinkedCellsContainer.h"
 
 class LinkedCellsContainerLocks : public LinkedCellsContainer {
+ private:
+  /// The load imbalance of the single parallel pass over all cells, measured while the phase timers are enabled
+  LoadImbalanceStatistics loadStatistics{1, "Pass"};
+
  public:
   LinkedCellsContainerLocks(double cellSize, std::array<double, 3> &leftLowerBound,
                             std::array<double, 3> &rightUpperBound)
-      : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound) {}
+      : LinkedCellsContainer(cellSize, leftLowerBound, rightUpperBound) {
+    parallelUpdates = true;
+  }
+
+  LoadImbalanceStatistics *getLoadImbalanceStatistics() override { return &loadStatistics; }
 #ifdef _OPENMP
 
  public:
   void forEachPair(std::function<void(Particle &, Particle &)> &binaryFunction) override {
     recalculateStructure();
     applyBoundaries();
+    if (hasPeriodicBoundaries) createGhostParticles();
 
-    if (hasPeriodicBoundaries) {
-      recalculateStructure();
-      applyPeriodicForces(binaryFunction);
-    }
-
-#pragma omp parallel for default(none) shared(binaryFunction, cells) schedule(guided)
-    for (size_t index = 0; index < cells.size(); ++index) {
-      if (cells[index].type == CellType::halo || cells[index].isEmpty()) {
-        continue;
-      }
-      cells[index].lock();
-      for (size_t indexOffset : indexOffsetAdjacent) {
-        // Special case to match particles within one cell
-        if (indexOffset == 0) {
-          auto &particles = cells[index].particles;
-          for (auto first = particles.begin(); first != particles.end(); ++first) {
-            for (auto second = std::next(first); second != particles.end(); ++second) {
-              binaryFunction(particlesVector[*first], particlesVector[*second]);
+    ScopedPhaseTimer pairLoopTimer{Phase::PairLoop};
+    auto passStart = LoadImbalanceStatistics::beginPass();
+#pragma omp parallel default(none) shared(binaryFunction, cells)
+    {
+      LoadImbalanceStatistics::ThreadWork work{loadStatistics};
+#pragma omp for schedule(guided) nowait
+      for (size_t index = 0; index < cells.size(); ++index) {
+        if (cells[index].type == CellType::halo || cells[index].isEmpty()) {
+          continue;
+        }
+        work.pairs += estimateCellPairCost(index);
+        cells[index].lock();
+        for (size_t indexOffset : indexOffsetAdjacent) {
+          // Special case to match particles within one cell
+          if (indexOffset == 0) {
+            auto &particles = cells[index].particles;
+            for (auto first = particles.begin(); first != particles.end(); ++first) {
+              for (auto second = std::next(first); second != particles.end(); ++second) {
+                binaryFunction(particlesVector[*first], particlesVector[*second]);
+              }
             }
-          }
 
-        } else {
-          cells[index + indexOffset].lock();
-          // Loop so the particles of each of the two cells and match them
-          for (auto indexA : cells[index].particles) {
-            for (auto indexB : cells[index + indexOffset].particles) {
-              binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+          } else {
+            cells[index + indexOffset].lock();
+            // Loop so the particles of each of the two cells and match them
+            for (auto indexA : cells[index].particles) {
+              for (auto indexB : cells[index + indexOffset].particles) {
+                binaryFunction(particlesVector[indexA], particlesVector[indexB]);
+              }
             }
+            cells[index + indexOffset].unlock();
           }
-          cells[index + indexOffset].unlock();
         }
+        cells[index].unlock();
       }
-      cells[index].unlock();
     }
+    loadStatistics.endPass(0, passStart);
+    pairLoopTimer.stop();
+
+    if (hasPeriodicBoundaries) removeGhostParticles();
 
     for (auto &structure : structuresVector) {
       if (structure.hasArtificalForces()) structure.applyArtificialForces();
@@ -0,0 +1,144 @@
+#include "LoadImbalanceStatistics.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <utility>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "utils/PhaseTimers.h"
+
+namespace {
+/**
+ * @return The index of the calling thread
+ */
+size_t getThreadNum() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+}  // namespace
+
+LoadImbalanceStatistics::ThreadWork::ThreadWork(LoadImbalanceStatistics &statistics)
+    : statistics{statistics}, active{LoadImbalanceStatistics::isEnabled()} {
+  if (active) start = std::chrono::steady_clock::now();
+}
+
+LoadImbalanceStatistics::ThreadWork::~ThreadWork() {
+  if (!active) return;
+  size_t threadNum = getThreadNum();
+  // Threads beyond the number of threads at construction are not recorded
+  if (threadNum >= statistics.threads.size()) return;
+
+  auto &slot = statistics.threads[threadNum];
+  slot.passBusySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  slot.passPairs = pairs;
+}
+
+LoadImbalanceStatistics::LoadImbalanceStatistics(size_t passCount, std::string passName)
+    : passes(passCount), passName{std::move(passName)} {
+#ifdef _OPENMP
+  threads.resize(std::max(omp_get_max_threads(), omp_get_num_procs()));
+#else
+  threads.resize(1);
+#endif
+}
+
+bool LoadImbalanceStatistics::isEnabled() { return PhaseTimers::isEnabled(); }
+
+std::chrono::steady_clock::time_point LoadImbalanceStatistics::beginPass() {
+  return isEnabled() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+}
+
+void LoadImbalanceStatistics::endPass(size_t pass, std::chrono::steady_clock::time_point start) {
+  if (!isEnabled()) return;
+
+  auto &summary = passes.at(pass);
+  double maxBusySeconds = 0., busySecondsSum = 0.;
+  size_t threadCount = 0;
+  for (auto &slot : threads) {
+    if (slot.passBusySeconds < 0) continue;
+
+    maxBusySeconds = std::max(maxBusySeconds, slot.passBusySeconds);
+    busySecondsSum += slot.passBusySeconds;
+    ++threadCount;
+    slot.busySeconds += slot.passBusySeconds;
+    slot.pairs += slot.passPairs;
+    summary.pairs += slot.passPairs;
+    slot.passBusySeconds = -1.;
+    slot.passPairs = 0;
+  }
+
+  ++summary.calls;
+  summary.wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  summary.maxBusySeconds += maxBusySeconds;
+  if (threadCount != 0) summary.meanBusySeconds += busySecondsSum / static_cast<double>(threadCount);
+}
+
+void LoadImbalanceStatistics::setPassCount(size_t passCount) {
+  passes.resize(passCount);
+  reset();
+}
+
+void LoadImbalanceStatistics::reset() {
+  std::fill(threads.begin(), threads.end(), ThreadSlot{});
+  std::fill(passes.begin(), passes.end(), PassSummary{});
+}
+
+std::vector<double> LoadImbalanceStatistics::getThreadBusySeconds() const {
+  std::vector<double> busySeconds;
+  for (auto &slot : threads) busySeconds.push_back(slot.busySeconds);
+  while (!busySeconds.empty() && busySeconds.back() == 0.) busySeconds.pop_back();
+  return busySeconds;
+}
+
+std::vector<std::uint64_t> LoadImbalanceStatistics::getThreadPairs() const {
+  std::vector<std::uint64_t> pairs;
+  for (auto &slot : threads) pairs.push_back(slot.pairs);
+  // Only as many threads as for the busy time, so both are reported for the same threads
+  pairs.resize(getThreadBusySeconds().size());
+  return pairs;
+}
+
+double LoadImbalanceStatistics::getImbalanceFactor() const {
+  double maxBusySeconds = 0., meanBusySeconds = 0.;
+  for (auto &summary : passes) {
+    maxBusySeconds += summary.maxBusySeconds;
+    meanBusySeconds += summary.meanBusySeconds;
+  }
+  return meanBusySeconds > 0 ? maxBusySeconds / meanBusySeconds : 1.;
+}
+
+void LoadImbalanceStatistics::print(std::ostream &stream) const {
+  auto flags = stream.flags();
+  stream << "Load imbalance of the parallel passes\n"
+         << std::left << std::setw(12) << passName << std::right << std::setw(10) << "Calls" << std::setw(14)
+         << "Wall [s]" << std::setw(14) << "Max busy [s]" << std::setw(15) << "Mean busy [s]" << std::setw(11)
+         << "Imbalance" << std::setw(16) << "Pairs"
+         << "\n"
+         << std::fixed;
+  for (size_t pass = 0; pass < passes.size(); ++pass) {
+    auto &summary = passes[pass];
+    if (summary.calls == 0) continue;
+    double imbalance = summary.meanBusySeconds > 0 ? summary.maxBusySeconds / summary.meanBusySeconds : 1.;
+    stream << std::left << std::setw(12) << pass << std::right << std::setw(10) << summary.calls
+           << std::setprecision(4) << std::setw(14) << summary.wallSeconds << std::setw(14) << summary.maxBusySeconds
+           << std::setw(15) << summary.meanBusySeconds << std::setprecision(2) << std::setw(11) << imbalance
+           << std::setw(16) << summary.pairs << "\n";
+  }
+
+  auto busySeconds = getThreadBusySeconds();
+  auto pairs = getThreadPairs();
+  stream << std::left << std::setw(12) << "Thread" << std::right << std::setw(14) << "Busy [s]" << std::setw(16)
+         << "Pairs"
+         << "\n";
+  for (size_t t = 0; t < busySeconds.size(); ++t) {
+    stream << std::left << std::setw(12) << t << std::right << std::setprecision(4) << std::setw(14) << busySeconds[t]
+           << std::setw(16) << pairs[t] << "\n";
+  }
+  stream << "Imbalance factor (max / mean busy time): " << std::setprecision(3) << getImbalanceFactor() << std::endl;
+  stream.flags(flags);
+}
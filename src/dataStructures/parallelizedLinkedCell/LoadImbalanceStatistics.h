@@ -0,0 +1,135 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Measures how evenly the parallel passes of a container are distributed among the threads. A pass is one parallel
+ * loop over cells, e.g. one colour of the colouring containers. For every pass the wall time and the busy time of each
+ * thread are measured, where the busy time ends when the thread runs out of work and not at the barrier. Also the
+ * number of particle pairs each thread processed is counted. The statistics are only measured while the phase timers
+ * are enabled.
+ */
+class LoadImbalanceStatistics {
+ public:
+  /// The accumulated measurements of a pass
+  struct PassSummary {
+    /// The number of times the pass was run
+    std::uint64_t calls{0};
+
+    /// The accumulated wall time of the pass
+    double wallSeconds{0.};
+
+    /// The accumulated busy time of the busiest thread of each run
+    double maxBusySeconds{0.};
+
+    /// The accumulated average busy time of the threads of each run
+    double meanBusySeconds{0.};
+
+    /// The number of particle pairs of the pass, before the cut off radius is checked
+    std::uint64_t pairs{0};
+  };
+
+  /**
+   * Measures the work of one thread within a pass from its construction until it goes out of scope. Has to be
+   * constructed by every thread of the parallel region, also by the ones that get no work.
+   */
+  class ThreadWork {
+   private:
+    LoadImbalanceStatistics &statistics;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+
+   public:
+    /// The particle pairs processed by the thread, counted by the loop of the container
+    std::uint64_t pairs{0};
+
+    explicit ThreadWork(LoadImbalanceStatistics &statistics);
+
+    ThreadWork(const ThreadWork &) = delete;
+    ThreadWork &operator=(const ThreadWork &) = delete;
+
+    ~ThreadWork();
+  };
+
+ private:
+  /// The measurements of one thread, padded to a cache line so that the threads do not write to the same line
+  struct alignas(64) ThreadSlot {
+    double busySeconds{0.};
+    std::uint64_t pairs{0};
+
+    /// The busy time of the current pass, -1 if the thread did not take part in it
+    double passBusySeconds{-1.};
+    std::uint64_t passPairs{0};
+  };
+
+  std::vector<ThreadSlot> threads;
+  std::vector<PassSummary> passes;
+
+  /// The name of a pass in the printed table, e.g. "Colour"
+  std::string passName;
+
+ public:
+  /**
+   * @param passCount The number of passes of the container
+   * @param passName The name of a pass in the printed table, e.g. "Colour"
+   */
+  LoadImbalanceStatistics(size_t passCount, std::string passName);
+
+  /**
+   * @return Whether the statistics are measured, which is the case while the phase timers are enabled
+   */
+  [[nodiscard]] static bool isEnabled();
+
+  /**
+   * Called before the parallel region of a pass
+   * @return The begin of the pass
+   */
+  [[nodiscard]] static std::chrono::steady_clock::time_point beginPass();
+
+  /**
+   * Collects the measurements of the threads after the parallel region of a pass
+   * @param pass The index of the pass
+   * @param start The begin of the pass returned by beginPass
+   */
+  void endPass(size_t pass, std::chrono::steady_clock::time_point start);
+
+  /**
+   * Changes the number of passes, for containers that know their passes only after the construction of the statistics.
+   * Clears all measurements.
+   * @param passCount The number of passes of the container
+   */
+  void setPassCount(size_t passCount);
+
+  /**
+   * Clears all measurements
+   */
+  void reset();
+
+  [[nodiscard]] const std::vector<PassSummary> &getPasses() const { return passes; }
+
+  /**
+   * @return The accumulated busy time of each thread up to the last thread that took part in a pass
+   */
+  [[nodiscard]] std::vector<double> getThreadBusySeconds() const;
+
+  /**
+   * @return The accumulated number of pairs of each thread up to the last thread that took part in a pass
+   */
+  [[nodiscard]] std::vector<std::uint64_t> getThreadPairs() const;
+
+  /**
+   * The imbalance factor is the time of the busiest threads divided by the average busy time over all passes. 1 means
+   * that the work is distributed perfectly, 2 that the threads are idle for half of the time of the passes.
+   * @return The imbalance factor, 1 if nothing was measured
+   */
+  [[nodiscard]] double getImbalanceFactor() const;
+
+  /**
+   * Prints the measurements of each pass and thread and the imbalance factor
+   * @param stream The stream the statistics are printed to
+   */
+  void print(std::ostream &stream) const;
+};
@@ -0,0 +1,152 @@
+#include "CheckpointBinaryReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "dataStructures/LinkedCellsContainer.h"
+#include "outputWriter/CheckpointBinaryFormat.h"
+#include "spdlog/spdlog.h"
+
+namespace {
+/**
+ * Read only memory mapping of a whole file, unmapped on destruction
+ */
+class MappedFile {
+ private:
+  const char *data{nullptr};
+  size_t size{0};
+
+ public:
+  explicit MappedFile(const char *filename) {
+    int descriptor = open(filename, O_RDONLY);
+    if (descriptor < 0) throw std::runtime_error(std::string("Could not open checkpoint file ") + filename);
+
+    struct stat status {};
+    if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+      size = static_cast<size_t>(status.st_size);
+      void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (mapping != MAP_FAILED) {
+        data = static_cast<const char *>(mapping);
+        madvise(mapping, size, MADV_SEQUENTIAL);
+      }
+    }
+    // The mapping stays valid after the file descriptor is closed
+    close(descriptor);
+
+    if (data == nullptr) throw std::runtime_error(std::string("Could not map checkpoint file ") + filename);
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  ~MappedFile() { munmap(const_cast<char *>(data), size); }
+
+  [[nodiscard]] const char *getData() const { return data; }
+
+  [[nodiscard]] size_t getSize() const { return size; }
+};
+
+/**
+ * Copies the record at the given offset, the copy avoids aliasing the mapped bytes as objects
+ */
+template <typename Record>
+Record readRecord(const char *data, size_t offset) {
+  Record record;
+  std::memcpy(&record, data + offset, sizeof(Record));
+  return record;
+}
+}  // namespace
+
+bool CheckpointBinaryReader::isBinaryCheckpoint(const char *filename) {
+  std::array<char, CheckpointBinaryFormat::magic.size()> start{};
+  std::ifstream file(filename, std::ios::binary);
+  return file.read(start.data(), start.size()) && start == CheckpointBinaryFormat::magic;
+}
+
+void CheckpointBinaryReader::readFile(IContainer &container, const char *filename) {
+  using namespace CheckpointBinaryFormat;
+  MappedFile mappedFile(filename);
+  const char *data = mappedFile.getData();
+
+  if (mappedFile.getSize() < sizeof(Header)) throw std::runtime_error("Checkpoint file is truncated.");
+  auto header = readRecord<Header>(data, 0);
+  if (header.magic != magic) throw std::runtime_error("File is not a binary checkpoint.");
+  if (header.byteOrderMark != byteOrderMark)
+    throw std::runtime_error("Checkpoint file was written on a machine with another byte order.");
+  if (header.version != version)
+    throw std::runtime_error("Checkpoint file has version " + std::to_string(header.version) + ", expected " +
+                             std::to_string(version) + ".");
+
+  // The counts are checked against the remaining bytes before multiplying, so corrupt counts cannot overflow
+  auto sectionEnd = [&mappedFile](size_t offset, std::uint64_t count, size_t recordSize) {
+    if (count > (mappedFile.getSize() - offset) / recordSize) throw std::runtime_error("Checkpoint file is truncated.");
+    return offset + count * recordSize;
+  };
+  size_t typesOffset = sizeof(Header);
+  size_t structuresOffset = sectionEnd(typesOffset, header.typeCount, sizeof(TypeRecord));
+  size_t particlesOffset = sectionEnd(structuresOffset, header.structureCount, sizeof(StructureRecord));
+  if (mappedFile.getSize() != sectionEnd(particlesOffset, header.particleCount, sizeof(ParticleRecord)))
+    throw std::runtime_error("Checkpoint file is truncated.");
+
+  spdlog::info("Reading {} particles from binary checkpoint {}", header.particleCount, filename);
+
+  // Types registered by the input file take precedence
+  for (size_t i = 0; i < header.typeCount; ++i) {
+    auto typeRecord = readRecord<TypeRecord>(data, typesOffset + i * sizeof(TypeRecord));
+    int type = static_cast<int>(typeRecord.type);
+    if (!Particle::getRegisteredParticleTypes().contains(type))
+      Particle::registerParticleType(type, typeRecord.epsilon, typeRecord.sigma);
+  }
+
+  auto *linkedCells = dynamic_cast<LinkedCellsContainer *>(&container);
+  if (header.hasDomain && linkedCells != nullptr &&
+      (linkedCells->getLeftLowerCorner() != header.leftLowerCorner ||
+       linkedCells->getRightUpperCorner() != header.rightUpperCorner)) {
+    spdlog::warn("The checkpoint was written for another domain. Particles outside of the domain may be lost.");
+  }
+
+  container.reserve(container.size() + header.particleCount);
+
+  // The membranes are created once all of their particles were added, since they refer to the last particles of the
+  // container. The writer stores them in ascending order of their start index.
+  size_t nextStructure = 0;
+  auto nextStructureRecord = [&]() {
+    return readRecord<StructureRecord>(data, structuresOffset + nextStructure * sizeof(StructureRecord));
+  };
+
+  for (size_t i = 0; i < header.particleCount; ++i) {
+    auto record = readRecord<ParticleRecord>(data, particlesOffset + i * sizeof(ParticleRecord));
+
+    Particle::restoreParticleType(record.type, record.epsilon, record.sigma);
+
+    Particle particle{record.type};
+    particle.x = record.x;
+    particle.v = record.v;
+    particle.f = record.f;
+    particle.old_f = record.oldF;
+    particle.m = record.m;
+    container.push_back(particle);
+    container.getHistory(container.getParticlesRef().back()) = {record.lastPosition,
+                                                                record.periodicBoundariesCrossed};
+
+    while (nextStructure < header.structureCount) {
+      auto structure = nextStructureRecord();
+      auto &dimensions = structure.dimensions;
+      if (structure.startIndex + dimensions[0] * dimensions[1] * dimensions[2] != i + 1) break;
+
+      container.push_back(MembraneStructure({dimensions[0], dimensions[1], dimensions[2]}, structure.stiffness,
+                                            structure.bondLength, structure.cutOff, container.getParticlesRef()));
+      ++nextStructure;
+    }
+  }
+
+  if (nextStructure != header.structureCount)
+    throw std::runtime_error("Checkpoint file contains membranes outside of the particle records.");
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include "dataStructures/IContainer.h"
+
+/**
+ * Loads checkpoints in the binary format described in outputWriter/CheckpointBinaryFormat.h. The file is memory
+ * mapped, so the particle records are read straight from the page cache instead of being parsed.
+ */
+class CheckpointBinaryReader {
+ public:
+  /**
+   * @param filename Path to a checkpoint file
+   * @return Whether the file starts with the magic bytes of the binary format
+   */
+  static bool isBinaryCheckpoint(const char *filename);
+
+  /**
+   * Adds the particles and membranes of a binary checkpoint to the container and registers the particle types that
+   * are not registered yet.
+   * @param container The container which receives the checkpointed particles
+   * @param filename Path to the checkpoint file
+   * @throws std::runtime_error If the file can not be read, was written by another version or on a machine with
+   * another byte order, or is truncated
+   */
+  static void readFile(IContainer &container, const char *filename);
+};
@@ -8,6 +8,7 @@
 #pragma once
 #include <vector>
 
+#include "CheckpointBinaryReader.h"
 #include "ILineProcessor.h"
 #include "LineProcessorCheckpoint.h"
 #include "LineProcessorCuboid.h"
@@ -58,13 +59,17 @@ class FileReader {
   }
 
   /**
-   * Reads in a file with particles packed in spheres and emplaces the read
-   * particles in the ParticleContainer
+   * Reads in a checkpoint file and emplaces the read particles in the
+   * ParticleContainer. Binary checkpoints are detected by their magic bytes.
    * @param particles The particleContainer in which the particles get emplaced
-   * @param filename Path to the input file, see cuboid-format specified in
-   * README.md
+   * @param filename Path to the checkpoint file
    */
   static void readFileCheckpoint(IContainer &particles, char *filename) {
+    if (CheckpointBinaryReader::isBinaryCheckpoint(filename)) {
+      CheckpointBinaryReader::readFile(particles, filename);
+      return;
+    }
+
     LineProcessorCheckpoint lineProcessor{};
     readFile(particles, filename, lineProcessor);
   }
@@ -6,17 +6,22 @@
 using v3d = std::array<double, 3>;
 
 void LineProcessorCheckpoint::processLine(std::istringstream &s, IContainer &container) {
-  Particle particle{};
-
   // Changing the order of the following lines, changes the order in which values are read from the input file
-  particle.x = getNextArray<3>(s);
-  particle.v = getNextArray<3>(s);
-  particle.old_f = getNextArray<3>(s);
-  particle.f = getNextArray<3>(s);
-  particle.m = getNext(s);
-  particle.type = {static_cast<int>(getNext(s))};
-  particle.epsilon = getNext(s);
-  particle.sigma = getNext(s);
+  auto x = getNextArray<3>(s);
+  auto v = getNextArray<3>(s);
+  auto old_f = getNextArray<3>(s);
+  auto f = getNextArray<3>(s);
+  double m = getNext(s);
+  int type = static_cast<int>(getNext(s));
+  double epsilon = getNext(s);
+  double sigma = getNext(s);
+
+  // The parameters are determined by the type, types registered by the input file take precedence
+  Particle::restoreParticleType(type, epsilon, sigma);
+
+  Particle particle{x, v, m, type};
+  particle.old_f = old_f;
+  particle.f = f;
 
   container.push_back(particle);
 }
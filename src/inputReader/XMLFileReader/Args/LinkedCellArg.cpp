@@ -40,3 +40,11 @@ const std::string &LinkedCellArg::getBoundBack() const { return bound_back; }
 void LinkedCellArg::setBoundBack(const std::string &boundBack) { bound_back = boundBack; }
 
 const std::string &LinkedCellArg::getParallelization() const { return parallelization; }
+
+unsigned int LinkedCellArg::getSortInterval() const { return sortInterval; }
+
+void LinkedCellArg::setSortInterval(unsigned int interval) { sortInterval = interval; }
+
+double LinkedCellArg::getSkin() const { return skin; }
+
+void LinkedCellArg::setSkin(double skinRadius) { skin = skinRadius; }
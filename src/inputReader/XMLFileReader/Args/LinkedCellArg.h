@@ -15,6 +15,8 @@ class LinkedCellArg {
   std::string bound_front;
   std::string bound_back;
   std::string parallelization;
+  unsigned int sortInterval{0};
+  double skin{0.3};
 
  public:
   LinkedCellArg(double cellSize, const std::array<double, 3> &leftLowerBound,
@@ -51,4 +53,12 @@ class LinkedCellArg {
   [[nodiscard]] const std::string &getBoundBack() const;
 
   void setBoundBack(const std::string &boundBack);
+
+  [[nodiscard]] unsigned int getSortInterval() const;
+
+  void setSortInterval(unsigned int interval);
+
+  [[nodiscard]] double getSkin() const;
+
+  void setSkin(double skinRadius);
 };
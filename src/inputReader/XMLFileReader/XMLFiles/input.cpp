@@ -139,6 +139,16 @@ simulation_t::radius_l_type& simulation_t::radius_l() { return this->radius_l_.g
 
 void simulation_t::radius_l(const radius_l_type& x) { this->radius_l_.set(x); }
 
+const simulation_t::fusedIntegration_optional& simulation_t::fusedIntegration() const {
+  return this->fusedIntegration_;
+}
+
+simulation_t::fusedIntegration_optional& simulation_t::fusedIntegration() { return this->fusedIntegration_; }
+
+void simulation_t::fusedIntegration(const fusedIntegration_type& x) { this->fusedIntegration_.set(x); }
+
+void simulation_t::fusedIntegration(const fusedIntegration_optional& x) { this->fusedIntegration_ = x; }
+
 // model_t
 //
 
@@ -335,6 +345,12 @@ containerTypes_t::VectorCont_sequence& containerTypes_t::VectorCont() { return t
 
 void containerTypes_t::VectorCont(const VectorCont_sequence& s) { this->VectorCont_ = s; }
 
+const containerTypes_t::BarnesHut_sequence& containerTypes_t::BarnesHut() const { return this->BarnesHut_; }
+
+containerTypes_t::BarnesHut_sequence& containerTypes_t::BarnesHut() { return this->BarnesHut_; }
+
+void containerTypes_t::BarnesHut(const BarnesHut_sequence& s) { this->BarnesHut_ = s; }
+
 // linkedCellContainer_t
 //
 
@@ -434,6 +450,24 @@ void linkedCellContainer_t::parallelization(::std::unique_ptr<parallelization_ty
   this->parallelization_.set(std::move(x));
 }
 
+const linkedCellContainer_t::sortInterval_optional& linkedCellContainer_t::sortInterval() const {
+  return this->sortInterval_;
+}
+
+linkedCellContainer_t::sortInterval_optional& linkedCellContainer_t::sortInterval() { return this->sortInterval_; }
+
+void linkedCellContainer_t::sortInterval(const sortInterval_type& x) { this->sortInterval_.set(x); }
+
+void linkedCellContainer_t::sortInterval(const sortInterval_optional& x) { this->sortInterval_ = x; }
+
+const linkedCellContainer_t::skin_optional& linkedCellContainer_t::skin() const { return this->skin_; }
+
+linkedCellContainer_t::skin_optional& linkedCellContainer_t::skin() { return this->skin_; }
+
+void linkedCellContainer_t::skin(const skin_type& x) { this->skin_.set(x); }
+
+void linkedCellContainer_t::skin(const skin_optional& x) { this->skin_ = x; }
+
 // paraType_t
 //
 
@@ -457,6 +491,17 @@ paraType_t& paraType_t::operator=(value v) {
 // vectorContainer_t
 //
 
+// barnesHutContainer_t
+//
+
+const barnesHutContainer_t::theta_optional& barnesHutContainer_t::theta() const { return this->theta_; }
+
+barnesHutContainer_t::theta_optional& barnesHutContainer_t::theta() { return this->theta_; }
+
+void barnesHutContainer_t::theta(const theta_type& x) { this->theta_.set(x); }
+
+void barnesHutContainer_t::theta(const theta_optional& x) { this->theta_ = x; }
+
 // boundary_t
 //
 
@@ -698,7 +743,8 @@ simulation_t::simulation_t(const Model_type& Model, const endTime_type& endTime,
       filename_(filename, this),
       cutOffRadius_(cutOffRadius, this),
       gravity_(gravity, this),
-      radius_l_(radius_l, this) {}
+      radius_l_(radius_l, this),
+      fusedIntegration_(this) {}
 
 simulation_t::simulation_t(const simulation_t& x, ::xml_schema::flags f, ::xml_schema::container* c)
     : ::xml_schema::type(x, f, c),
@@ -716,7 +762,8 @@ simulation_t::simulation_t(const simulation_t& x, ::xml_schema::flags f, ::xml_s
       filename_(x.filename_, f, this),
       cutOffRadius_(x.cutOffRadius_, f, this),
       gravity_(x.gravity_, f, this),
-      radius_l_(x.radius_l_, f, this) {}
+      radius_l_(x.radius_l_, f, this),
+      fusedIntegration_(x.fusedIntegration_, f, this) {}
 
 simulation_t::simulation_t(const ::xercesc::DOMElement& e, ::xml_schema::flags f, ::xml_schema::container* c)
     : ::xml_schema::type(e, f | ::xml_schema::flags::base, c),
@@ -734,7 +781,8 @@ simulation_t::simulation_t(const ::xercesc::DOMElement& e, ::xml_schema::flags f
       filename_(this),
       cutOffRadius_(this),
       gravity_(this),
-      radius_l_(this) {
+      radius_l_(this),
+      fusedIntegration_(this) {
   if ((f & ::xml_schema::flags::base) == 0) {
     ::xsd::cxx::xml::dom::parser<char> p(e, true, false, true);
     this->parse(p, f);
@@ -855,6 +903,11 @@ void simulation_t::parse(::xsd::cxx::xml::dom::parser<char>& p, ::xml_schema::fl
       this->radius_l_.set(radius_l_traits::create(i, f, this));
       continue;
     }
+
+    if (n.name() == "fusedIntegration" && n.namespace_().empty()) {
+      this->fusedIntegration_.set(fusedIntegration_traits::create(i, f, this));
+      continue;
+    }
   }
 
   if (!Model_.present()) {
@@ -912,6 +965,7 @@ simulation_t& simulation_t::operator=(const simulation_t& x) {
     this->cutOffRadius_ = x.cutOffRadius_;
     this->gravity_ = x.gravity_;
     this->radius_l_ = x.radius_l_;
+    this->fusedIntegration_ = x.fusedIntegration_;
   }
 
   return *this;
@@ -1518,13 +1572,17 @@ input_t::~input_t() {}
 // containerTypes_t
 //
 
-containerTypes_t::containerTypes_t() : ::xml_schema::type(), LinkedCell_(this), VectorCont_(this) {}
+containerTypes_t::containerTypes_t()
+    : ::xml_schema::type(), LinkedCell_(this), VectorCont_(this), BarnesHut_(this) {}
 
 containerTypes_t::containerTypes_t(const containerTypes_t& x, ::xml_schema::flags f, ::xml_schema::container* c)
-    : ::xml_schema::type(x, f, c), LinkedCell_(x.LinkedCell_, f, this), VectorCont_(x.VectorCont_, f, this) {}
+    : ::xml_schema::type(x, f, c),
+      LinkedCell_(x.LinkedCell_, f, this),
+      VectorCont_(x.VectorCont_, f, this),
+      BarnesHut_(x.BarnesHut_, f, this) {}
 
 containerTypes_t::containerTypes_t(const ::xercesc::DOMElement& e, ::xml_schema::flags f, ::xml_schema::container* c)
-    : ::xml_schema::type(e, f | ::xml_schema::flags::base, c), LinkedCell_(this), VectorCont_(this) {
+    : ::xml_schema::type(e, f | ::xml_schema::flags::base, c), LinkedCell_(this), VectorCont_(this), BarnesHut_(this) {
   if ((f & ::xml_schema::flags::base) == 0) {
     ::xsd::cxx::xml::dom::parser<char> p(e, true, false, false);
     this->parse(p, f);
@@ -1554,6 +1612,15 @@ void containerTypes_t::parse(::xsd::cxx::xml::dom::parser<char>& p, ::xml_schema
       continue;
     }
 
+    // BarnesHut
+    //
+    if (n.name() == "BarnesHut" && n.namespace_().empty()) {
+      ::std::unique_ptr<BarnesHut_type> r(BarnesHut_traits::create(i, f, this));
+
+      this->BarnesHut_.push_back(::std::move(r));
+      continue;
+    }
+
     break;
   }
 }
@@ -1567,6 +1634,7 @@ containerTypes_t& containerTypes_t::operator=(const containerTypes_t& x) {
     static_cast< ::xml_schema::type&>(*this) = x;
     this->LinkedCell_ = x.LinkedCell_;
     this->VectorCont_ = x.VectorCont_;
+    this->BarnesHut_ = x.BarnesHut_;
   }
 
   return *this;
@@ -1592,7 +1660,9 @@ linkedCellContainer_t::linkedCellContainer_t(const leftLowerBound_type& leftLowe
       front_(front, this),
       back_(back, this),
       cellSize_(cellSize, this),
-      parallelization_(parallelization, this) {}
+      parallelization_(parallelization, this),
+      sortInterval_(this),
+      skin_(this) {}
 
 linkedCellContainer_t::linkedCellContainer_t(::std::unique_ptr<leftLowerBound_type> leftLowerBound,
                                              ::std::unique_ptr<rightUpperBound_type> rightUpperBound,
@@ -1609,7 +1679,9 @@ linkedCellContainer_t::linkedCellContainer_t(::std::unique_ptr<leftLowerBound_ty
       front_(front, this),
       back_(back, this),
       cellSize_(cellSize, this),
-      parallelization_(parallelization, this) {}
+      parallelization_(parallelization, this),
+      sortInterval_(this),
+      skin_(this) {}
 
 linkedCellContainer_t::linkedCellContainer_t(const linkedCellContainer_t& x, ::xml_schema::flags f,
                                              ::xml_schema::container* c)
@@ -1623,7 +1695,9 @@ linkedCellContainer_t::linkedCellContainer_t(const linkedCellContainer_t& x, ::x
       front_(x.front_, f, this),
       back_(x.back_, f, this),
       cellSize_(x.cellSize_, f, this),
-      parallelization_(x.parallelization_, f, this) {}
+      parallelization_(x.parallelization_, f, this),
+      sortInterval_(x.sortInterval_, f, this),
+      skin_(x.skin_, f, this) {}
 
 linkedCellContainer_t::linkedCellContainer_t(const ::xercesc::DOMElement& e, ::xml_schema::flags f,
                                              ::xml_schema::container* c)
@@ -1637,7 +1711,9 @@ linkedCellContainer_t::linkedCellContainer_t(const ::xercesc::DOMElement& e, ::x
       front_(this),
       back_(this),
       cellSize_(this),
-      parallelization_(this) {
+      parallelization_(this),
+      sortInterval_(this),
+      skin_(this) {
   if ((f & ::xml_schema::flags::base) == 0) {
     ::xsd::cxx::xml::dom::parser<char> p(e, true, false, true);
     this->parse(p, f);
@@ -1785,6 +1861,16 @@ void linkedCellContainer_t::parse(::xsd::cxx::xml::dom::parser<char>& p, ::xml_s
       this->parallelization_.set(parallelization_traits::create(i, f, this));
       continue;
     }
+
+    if (n.name() == "sortInterval" && n.namespace_().empty()) {
+      this->sortInterval_.set(sortInterval_traits::create(i, f, this));
+      continue;
+    }
+
+    if (n.name() == "skin" && n.namespace_().empty()) {
+      this->skin_.set(skin_traits::create(i, f, this));
+      continue;
+    }
   }
 
   if (!cellSize_.present()) {
@@ -1813,6 +1899,8 @@ linkedCellContainer_t& linkedCellContainer_t::operator=(const linkedCellContaine
     this->back_ = x.back_;
     this->cellSize_ = x.cellSize_;
     this->parallelization_ = x.parallelization_;
+    this->sortInterval_ = x.sortInterval_;
+    this->skin_ = x.skin_;
   }
 
   return *this;
@@ -1845,19 +1933,22 @@ paraType_t* paraType_t::_clone(::xml_schema::flags f, ::xml_schema::container* c
 
 paraType_t::value paraType_t::_xsd_paraType_t_convert() const {
   ::xsd::cxx::tree::enum_comparator<char> c(_xsd_paraType_t_literals_);
-  const value* i(::std::lower_bound(_xsd_paraType_t_indexes_, _xsd_paraType_t_indexes_ + 4, *this, c));
+  const value* i(::std::lower_bound(_xsd_paraType_t_indexes_, _xsd_paraType_t_indexes_ + 8, *this, c));
 
-  if (i == _xsd_paraType_t_indexes_ + 4 || _xsd_paraType_t_literals_[*i] != *this) {
+  if (i == _xsd_paraType_t_indexes_ + 8 || _xsd_paraType_t_literals_[*i] != *this) {
     throw ::xsd::cxx::tree::unexpected_enumerator<char>(*this);
   }
 
   return *i;
 }
 
-const char* const paraType_t::_xsd_paraType_t_literals_[4] = {"None", "ColouringSingle", "ColouringMultiple", "Locks"};
+const char* const paraType_t::_xsd_paraType_t_literals_[8] = {
+    "None", "ColouringSingle", "ColouringMultiple", "Locks", "SoA", "Verlet", "ForceBuffer", "ForceBufferBlocked"};
 
-const paraType_t::value paraType_t::_xsd_paraType_t_indexes_[4] = {
-    ::paraType_t::ColouringMultiple, ::paraType_t::ColouringSingle, ::paraType_t::Locks, ::paraType_t::None};
+const paraType_t::value paraType_t::_xsd_paraType_t_indexes_[8] = {
+    ::paraType_t::ColouringMultiple, ::paraType_t::ColouringSingle, ::paraType_t::ForceBuffer,
+    ::paraType_t::ForceBufferBlocked, ::paraType_t::Locks,          ::paraType_t::None,
+    ::paraType_t::SoA,               ::paraType_t::Verlet};
 
 // vectorContainer_t
 //
@@ -1883,6 +1974,51 @@ vectorContainer_t* vectorContainer_t::_clone(::xml_schema::flags f, ::xml_schema
 
 vectorContainer_t::~vectorContainer_t() {}
 
+// barnesHutContainer_t
+//
+
+barnesHutContainer_t::barnesHutContainer_t() : ::xml_schema::type(), theta_(this) {}
+
+barnesHutContainer_t::barnesHutContainer_t(const barnesHutContainer_t& x, ::xml_schema::flags f,
+                                           ::xml_schema::container* c)
+    : ::xml_schema::type(x, f, c), theta_(x.theta_, f, this) {}
+
+barnesHutContainer_t::barnesHutContainer_t(const ::xercesc::DOMElement& e, ::xml_schema::flags f,
+                                           ::xml_schema::container* c)
+    : ::xml_schema::type(e, f | ::xml_schema::flags::base, c), theta_(this) {
+  if ((f & ::xml_schema::flags::base) == 0) {
+    ::xsd::cxx::xml::dom::parser<char> p(e, false, false, true);
+    this->parse(p, f);
+  }
+}
+
+void barnesHutContainer_t::parse(::xsd::cxx::xml::dom::parser<char>& p, ::xml_schema::flags f) {
+  while (p.more_attributes()) {
+    const ::xercesc::DOMAttr& i(p.next_attribute());
+    const ::xsd::cxx::xml::qualified_name<char> n(::xsd::cxx::xml::dom::name<char>(i));
+
+    if (n.name() == "theta" && n.namespace_().empty()) {
+      this->theta_.set(theta_traits::create(i, f, this));
+      continue;
+    }
+  }
+}
+
+barnesHutContainer_t* barnesHutContainer_t::_clone(::xml_schema::flags f, ::xml_schema::container* c) const {
+  return new class barnesHutContainer_t(*this, f, c);
+}
+
+barnesHutContainer_t& barnesHutContainer_t::operator=(const barnesHutContainer_t& x) {
+  if (this != &x) {
+    static_cast< ::xml_schema::type&>(*this) = x;
+    this->theta_ = x.theta_;
+  }
+
+  return *this;
+}
+
+barnesHutContainer_t::~barnesHutContainer_t() {}
+
 // boundary_t
 //
 
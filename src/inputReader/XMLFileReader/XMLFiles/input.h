@@ -231,6 +231,7 @@ class containerTypes_t;
 class linkedCellContainer_t;
 class paraType_t;
 class vectorContainer_t;
+class barnesHutContainer_t;
 class boundary_t;
 class thermostat_t;
 class particle_t;
@@ -441,6 +442,20 @@ class simulation_t : public ::xml_schema::type {
 
   void radius_l(const radius_l_type& x);
 
+  // fusedIntegration
+  //
+  typedef ::xml_schema::boolean fusedIntegration_type;
+  typedef ::xsd::cxx::tree::optional<fusedIntegration_type> fusedIntegration_optional;
+  typedef ::xsd::cxx::tree::traits<fusedIntegration_type, char> fusedIntegration_traits;
+
+  const fusedIntegration_optional& fusedIntegration() const;
+
+  fusedIntegration_optional& fusedIntegration();
+
+  void fusedIntegration(const fusedIntegration_type& x);
+
+  void fusedIntegration(const fusedIntegration_optional& x);
+
   // Constructors.
   //
   simulation_t(const Model_type&, const endTime_type&, const deltaT_type&, const writeOutFrequency_type&,
@@ -477,6 +492,7 @@ class simulation_t : public ::xml_schema::type {
   ::xsd::cxx::tree::one<cutOffRadius_type> cutOffRadius_;
   ::xsd::cxx::tree::one<gravity_type> gravity_;
   ::xsd::cxx::tree::one<radius_l_type> radius_l_;
+  fusedIntegration_optional fusedIntegration_;
 };
 
 class model_t : public ::xml_schema::string {
@@ -978,6 +994,20 @@ class containerTypes_t : public ::xml_schema::type {
 
   void VectorCont(const VectorCont_sequence& s);
 
+  // BarnesHut
+  //
+  typedef ::barnesHutContainer_t BarnesHut_type;
+  typedef ::xsd::cxx::tree::sequence<BarnesHut_type> BarnesHut_sequence;
+  typedef BarnesHut_sequence::iterator BarnesHut_iterator;
+  typedef BarnesHut_sequence::const_iterator BarnesHut_const_iterator;
+  typedef ::xsd::cxx::tree::traits<BarnesHut_type, char> BarnesHut_traits;
+
+  const BarnesHut_sequence& BarnesHut() const;
+
+  BarnesHut_sequence& BarnesHut();
+
+  void BarnesHut(const BarnesHut_sequence& s);
+
   // Constructors.
   //
   containerTypes_t();
@@ -1000,6 +1030,7 @@ class containerTypes_t : public ::xml_schema::type {
  protected:
   LinkedCell_sequence LinkedCell_;
   VectorCont_sequence VectorCont_;
+  BarnesHut_sequence BarnesHut_;
 };
 
 class linkedCellContainer_t : public ::xml_schema::type {
@@ -1132,6 +1163,34 @@ class linkedCellContainer_t : public ::xml_schema::type {
 
   void parallelization(::std::unique_ptr<parallelization_type> p);
 
+  // sortInterval
+  //
+  typedef ::xml_schema::unsigned_int sortInterval_type;
+  typedef ::xsd::cxx::tree::optional<sortInterval_type> sortInterval_optional;
+  typedef ::xsd::cxx::tree::traits<sortInterval_type, char> sortInterval_traits;
+
+  const sortInterval_optional& sortInterval() const;
+
+  sortInterval_optional& sortInterval();
+
+  void sortInterval(const sortInterval_type& x);
+
+  void sortInterval(const sortInterval_optional& x);
+
+  // skin
+  //
+  typedef ::xml_schema::double_ skin_type;
+  typedef ::xsd::cxx::tree::optional<skin_type> skin_optional;
+  typedef ::xsd::cxx::tree::traits<skin_type, char, ::xsd::cxx::tree::schema_type::double_> skin_traits;
+
+  const skin_optional& skin() const;
+
+  skin_optional& skin();
+
+  void skin(const skin_type& x);
+
+  void skin(const skin_optional& x);
+
   // Constructors.
   //
   linkedCellContainer_t(const leftLowerBound_type&, const rightUpperBound_type&, const left_type&, const right_type&,
@@ -1168,11 +1227,22 @@ class linkedCellContainer_t : public ::xml_schema::type {
   ::xsd::cxx::tree::one<back_type> back_;
   ::xsd::cxx::tree::one<cellSize_type> cellSize_;
   ::xsd::cxx::tree::one<parallelization_type> parallelization_;
+  sortInterval_optional sortInterval_;
+  skin_optional skin_;
 };
 
 class paraType_t : public ::xml_schema::string {
  public:
-  enum value { None, ColouringSingle, ColouringMultiple, Locks };
+  enum value {
+    None,
+    ColouringSingle,
+    ColouringMultiple,
+    Locks,
+    SoA,
+    Verlet,
+    ForceBuffer,
+    ForceBufferBlocked
+  };
 
   paraType_t(value v);
 
@@ -1201,8 +1271,8 @@ class paraType_t : public ::xml_schema::string {
   value _xsd_paraType_t_convert() const;
 
  public:
-  static const char* const _xsd_paraType_t_literals_[4];
-  static const value _xsd_paraType_t_indexes_[4];
+  static const char* const _xsd_paraType_t_literals_[8];
+  static const value _xsd_paraType_t_indexes_[8];
 };
 
 class vectorContainer_t : public ::xml_schema::type {
@@ -1225,6 +1295,45 @@ class vectorContainer_t : public ::xml_schema::type {
   virtual ~vectorContainer_t();
 };
 
+class barnesHutContainer_t : public ::xml_schema::type {
+ public:
+  // theta
+  //
+  typedef ::xml_schema::double_ theta_type;
+  typedef ::xsd::cxx::tree::optional<theta_type> theta_optional;
+  typedef ::xsd::cxx::tree::traits<theta_type, char, ::xsd::cxx::tree::schema_type::double_> theta_traits;
+
+  const theta_optional& theta() const;
+
+  theta_optional& theta();
+
+  void theta(const theta_type& x);
+
+  void theta(const theta_optional& x);
+
+  // Constructors.
+  //
+  barnesHutContainer_t();
+
+  barnesHutContainer_t(const ::xercesc::DOMElement& e, ::xml_schema::flags f = 0, ::xml_schema::container* c = 0);
+
+  barnesHutContainer_t(const barnesHutContainer_t& x, ::xml_schema::flags f = 0, ::xml_schema::container* c = 0);
+
+  virtual barnesHutContainer_t* _clone(::xml_schema::flags f = 0, ::xml_schema::container* c = 0) const;
+
+  barnesHutContainer_t& operator=(const barnesHutContainer_t& x);
+
+  virtual ~barnesHutContainer_t();
+
+  // Implementation.
+  //
+ protected:
+  void parse(::xsd::cxx::xml::dom::parser<char>&, ::xml_schema::flags);
+
+ protected:
+  theta_optional theta_;
+};
+
 class boundary_t : public ::xml_schema::string {
  public:
   enum value { OUTFLOW, REFLECT, PERIODIC };
@@ -92,6 +92,8 @@ class XMLParser {
   ContainerType getContainerType() {
     if (simulation->Container_T().front().VectorCont().size() > 0) return ContainerType::VECTOR;
 
+    if (simulation->Container_T().front().BarnesHut().size() > 0) return ContainerType::BARNES_HUT;
+
     if (simulation->Container_T().front().LinkedCell().size() > 0) {
       std::string parallelization = simulation->Container_T().front().LinkedCell().front().parallelization();
 
@@ -102,6 +104,14 @@ class XMLParser {
       if (parallelization == "ColouringMultiple") return ContainerType::LINKED_CELLS_COLOURING_MULTIPLE;
 
       if (parallelization == "Locks") return ContainerType::LINKED_CELLS_LOCKS;
+
+      if (parallelization == "SoA") return ContainerType::LINKED_CELLS_SOA;
+
+      if (parallelization == "Verlet") return ContainerType::LINKED_CELLS_VERLET;
+
+      if (parallelization == "ForceBuffer") return ContainerType::LINKED_CELLS_FORCE_BUFFER;
+
+      if (parallelization == "ForceBufferBlocked") return ContainerType::LINKED_CELLS_FORCE_BUFFER_BLOCKED;
     }
 
     throw std::runtime_error("Please update XMLParser.h, if there is a new container type.");
@@ -135,8 +145,22 @@ class XMLParser {
     linkedCellArg.setBoundBottom(bottom);
     linkedCellArg.setBoundFront(front);
     linkedCellArg.setBoundBack(back);
+    if (c.sortInterval().present()) linkedCellArg.setSortInterval(c.sortInterval().get());
+    if (c.skin().present()) linkedCellArg.setSkin(c.skin().get());
     return linkedCellArg;
   }
+
+  /**
+   * Extracts the opening angle of the Barnes-Hut container from the XML file
+   * @return The opening angle, 0.5 if it is not specified
+   */
+  double extractBarnesHutTheta() {
+    if (simulation->Container_T().size() < 1 || simulation->Container_T().front().BarnesHut().size() != 1)
+      throw std::invalid_argument("XML Parser expected a single Barnes-Hut container.");
+
+    auto &c = simulation->Container_T().front().BarnesHut().front();
+    return c.theta().present() ? c.theta().get() : 0.5;
+  }
   /**
    * Extracts the arguments (position, velocity, dimension, distance, mass,
    * type) used to initialise cuboids from the XML file
@@ -378,6 +402,13 @@ class XMLParser {
    */
   [[nodiscard]] double getGravityConstant() const { return simulation->gravity(); }
 
+  /**
+   * @return Whether the integration steps are fused with each other and the force calculation, false if not specified
+   */
+  [[nodiscard]] bool getFusedIntegration() const {
+    return simulation->fusedIntegration().present() && simulation->fusedIntegration().get();
+  }
+
   /**
    * @return The selected model
    */
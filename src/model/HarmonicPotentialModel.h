@@ -1,4 +1,6 @@
 #pragma once
+#include <cmath>
+
 #include "LennardJonesModel.h"
 
 class HarmonicPotentialModel : public LennardJonesModel {
@@ -19,6 +21,11 @@ class HarmonicPotentialModel : public LennardJonesModel {
         bondLength{bondLength_},
         harmonicCutOffSquared{cutOff * cutOff} {};
 
+  /**
+   * @return The radius at which direct and diagonal forces are applied at
+   */
+  [[nodiscard]] double getHarmonicCutOff() const { return std::sqrt(harmonicCutOffSquared); }
+
   /**
    * Applies the membrane default force that is meant to be applied to direct neighbours
    * (= particles that are either horizontal or vertical neighbours).
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <stdexcept>
+
 #include "dataStructures/Particle.h"
+#include "dataStructures/ParticleSoA.h"
+#include "model/PairObservables.h"
 #include "utils/ArrayUtils.h"
 
 class IModel {
@@ -34,6 +38,44 @@ class IModel {
    */
   virtual void addForces(Particle &p1, Particle &p2) const = 0;
 
+  /**
+   * Like addForces, but also adds the potential energy and virial of the pair onto the observables. Models without a
+   * potential only apply the forces.
+   * @param p1 The particle that gets influenced by particle p2
+   * @param p2 The particle that gets influenced by particle p1
+   * @param observables The observables of the calling thread
+   */
+  virtual void addForcesAndObservables(Particle &p1, Particle &p2, PairObservables &observables) const {
+    addForces(p1, p2);
+  }
+
+  /**
+   * Calculates the force p2 applies upon p1 without applying it. By Newton's third law p1 applies the negated force
+   * upon p2. Models should override this, the default implementation applies addForces onto copies of the particles.
+   * @param p1 The particle that gets influenced by particle p2
+   * @param p2 The particle that influences particle p1
+   * @return The force acting upon p1
+   */
+  virtual std::array<double, 3> calculateForce(Particle &p1, Particle &p2) const {
+    Particle first{p1};
+    Particle second{p2};
+    first.setF({0., 0., 0.});
+    second.setF({0., 0., 0.});
+    addForces(first, second);
+    return first.getF();
+  }
+
+  /**
+   * Let the forces of two particles that are stored in a structure of arrays interact. Forces simply add up on both
+   * particles.
+   * @param soa The structure of arrays containing both particles
+   * @param i The index of the particle that gets influenced by particle j
+   * @param j The index of the particle that gets influenced by particle i
+   */
+  virtual void addForcesSoA(ParticleSoA &soa, size_t i, size_t j) const {
+    throw std::runtime_error("Model does not support the structure of arrays layout.");
+  }
+
   /**
    * Sets the time period for the individual simulation iterations.
    * @param d_t Simulated length of a single iteration
@@ -0,0 +1,232 @@
+#include "LennardJonesKernels.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#ifdef MOLSIM_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace LennardJonesKernels {
+
+/**
+ * Applies the Lennard-Jones forces of a single pair, see LennardJonesModel::addForcesSoA
+ */
+static inline void addPairForces(ParticleSoA &soa, size_t i, size_t j, double cutOffRadiusSquared,
+                                 const Particle::PairParameters *parametersI) {
+  double dx = soa.x[i] - soa.x[j];
+  double dy = soa.y[i] - soa.y[j];
+  double dz = soa.z[i] - soa.z[j];
+  double length_sqr = dx * dx + dy * dy + dz * dz;
+
+  if (length_sqr >= cutOffRadiusSquared) return;
+
+  auto &parameters = parametersI[soa.typeIndex[j]];
+  double sig_len = parameters.sigmaSquared / length_sqr;  // (sigma²/length²)
+  sig_len *= sig_len * sig_len;                           // (sigma²/length²)³
+
+  double scalar = (-parameters.epsilon24 / length_sqr) * (sig_len * (1 - (2 * sig_len)));
+
+  soa.fx[i] += scalar * dx;
+  soa.fy[i] += scalar * dy;
+  soa.fz[i] += scalar * dz;
+  soa.fx[j] -= scalar * dx;
+  soa.fy[j] -= scalar * dy;
+  soa.fz[j] -= scalar * dz;
+}
+
+void scalarKernel(ParticleSoA &soa, size_t i, size_t begin, size_t end, double cutOffRadiusSquared) {
+  auto *parametersI = Particle::getPairParametersRow(soa.typeIndex[i]);
+  for (size_t j = begin; j < end; ++j) addPairForces(soa, i, j, cutOffRadiusSquared, parametersI);
+}
+
+#ifdef MOLSIM_X86_KERNELS
+// The gathers multiply the type indices by 4 to get the offset of the parameters in doubles
+static_assert(sizeof(Particle::PairParameters) == 4 * sizeof(double));
+
+/**
+ * Sums up the 4 lanes of an AVX register
+ */
+__attribute__((target("avx2"))) static inline double horizontalSum(__m256d v) {
+  __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+__attribute__((target("avx2"))) void avx2Kernel(ParticleSoA &soa, size_t i, size_t begin, size_t end,
+                                                double cutOffRadiusSquared) {
+  const __m256d xi = _mm256_set1_pd(soa.x[i]);
+  const __m256d yi = _mm256_set1_pd(soa.y[i]);
+  const __m256d zi = _mm256_set1_pd(soa.z[i]);
+  const auto *parametersI = Particle::getPairParametersRow(soa.typeIndex[i]);
+  const auto *epsilon24I = &parametersI->epsilon24;
+  const auto *sigmaSquaredI = &parametersI->sigmaSquared;
+  const __m256d cutOff = _mm256_set1_pd(cutOffRadiusSquared);
+  const __m256d one = _mm256_set1_pd(1.);
+  const __m256d two = _mm256_set1_pd(2.);
+  const __m256d allLanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+  __m256d fxi = _mm256_setzero_pd();
+  __m256d fyi = _mm256_setzero_pd();
+  __m256d fzi = _mm256_setzero_pd();
+
+  size_t j = begin;
+  for (; j + 4 <= end; j += 4) {
+    __m256d dx = _mm256_sub_pd(xi, _mm256_loadu_pd(&soa.x[j]));
+    __m256d dy = _mm256_sub_pd(yi, _mm256_loadu_pd(&soa.y[j]));
+    __m256d dz = _mm256_sub_pd(zi, _mm256_loadu_pd(&soa.z[j]));
+    __m256d lengthSqr =
+        _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+
+    // Lanes beyond the cut off radius get a force scalar of 0
+    __m256d mask = _mm256_cmp_pd(lengthSqr, cutOff, _CMP_LT_OQ);
+    if (_mm256_movemask_pd(mask) == 0) continue;
+
+    // Gather the parameters of the pairs from the row of the mixing table of particle i
+    __m128i types = _mm_slli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&soa.typeIndex[j])), 2);
+    // The masked gathers with a zero source avoid the undefined source register of the unmasked ones
+    __m256d epsilon24 = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), epsilon24I, types, allLanes, sizeof(double));
+    __m256d sigmaSquared =
+        _mm256_mask_i32gather_pd(_mm256_setzero_pd(), sigmaSquaredI, types, allLanes, sizeof(double));
+
+    __m256d sigLen = _mm256_div_pd(sigmaSquared, lengthSqr);         // (sigma²/length²)
+    sigLen = _mm256_mul_pd(sigLen, _mm256_mul_pd(sigLen, sigLen));  // (sigma²/length²)³
+
+    __m256d scalar = _mm256_mul_pd(_mm256_div_pd(epsilon24, lengthSqr),
+                                   _mm256_mul_pd(sigLen, _mm256_sub_pd(_mm256_mul_pd(two, sigLen), one)));
+    scalar = _mm256_and_pd(scalar, mask);
+
+    __m256d forceX = _mm256_mul_pd(scalar, dx);
+    __m256d forceY = _mm256_mul_pd(scalar, dy);
+    __m256d forceZ = _mm256_mul_pd(scalar, dz);
+    fxi = _mm256_add_pd(fxi, forceX);
+    fyi = _mm256_add_pd(fyi, forceY);
+    fzi = _mm256_add_pd(fzi, forceZ);
+    _mm256_storeu_pd(&soa.fx[j], _mm256_sub_pd(_mm256_loadu_pd(&soa.fx[j]), forceX));
+    _mm256_storeu_pd(&soa.fy[j], _mm256_sub_pd(_mm256_loadu_pd(&soa.fy[j]), forceY));
+    _mm256_storeu_pd(&soa.fz[j], _mm256_sub_pd(_mm256_loadu_pd(&soa.fz[j]), forceZ));
+  }
+
+  for (; j < end; ++j) addPairForces(soa, i, j, cutOffRadiusSquared, parametersI);
+
+  soa.fx[i] += horizontalSum(fxi);
+  soa.fy[i] += horizontalSum(fyi);
+  soa.fz[i] += horizontalSum(fzi);
+}
+
+/**
+ * Sums up the 8 lanes of an AVX-512 register
+ */
+__attribute__((target("avx512f"))) static inline double horizontalSum(__m512d v) {
+  // Going through memory avoids the undefined registers of _mm512_reduce_add_pd, which trigger false positive warnings
+  double lanes[8];
+  _mm512_storeu_pd(lanes, v);
+  return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+__attribute__((target("avx512f,avx512vl"))) void avx512Kernel(ParticleSoA &soa, size_t i, size_t begin, size_t end,
+                                                     double cutOffRadiusSquared) {
+  const __m512d xi = _mm512_set1_pd(soa.x[i]);
+  const __m512d yi = _mm512_set1_pd(soa.y[i]);
+  const __m512d zi = _mm512_set1_pd(soa.z[i]);
+  const auto *parametersI = Particle::getPairParametersRow(soa.typeIndex[i]);
+  const auto *epsilon24I = &parametersI->epsilon24;
+  const auto *sigmaSquaredI = &parametersI->sigmaSquared;
+  const __m512d cutOff = _mm512_set1_pd(cutOffRadiusSquared);
+  const __m512d one = _mm512_set1_pd(1.);
+  const __m512d two = _mm512_set1_pd(2.);
+
+  __m512d fxi = _mm512_setzero_pd();
+  __m512d fyi = _mm512_setzero_pd();
+  __m512d fzi = _mm512_setzero_pd();
+
+  // The remainder is handled with a partial mask instead of a scalar loop
+  for (size_t j = begin; j < end; j += 8) {
+    __mmask8 lanes = end - j >= 8 ? 0xFF : static_cast<__mmask8>((1u << (end - j)) - 1);
+
+    __m512d dx = _mm512_sub_pd(xi, _mm512_maskz_loadu_pd(lanes, &soa.x[j]));
+    __m512d dy = _mm512_sub_pd(yi, _mm512_maskz_loadu_pd(lanes, &soa.y[j]));
+    __m512d dz = _mm512_sub_pd(zi, _mm512_maskz_loadu_pd(lanes, &soa.z[j]));
+    __m512d lengthSqr =
+        _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy)), _mm512_mul_pd(dz, dz));
+
+    // Lanes beyond the cut off radius or the range do not contribute
+    __mmask8 mask = _mm512_mask_cmp_pd_mask(lanes, lengthSqr, cutOff, _CMP_LT_OQ);
+    if (mask == 0) continue;
+
+    // Gather the parameters of the pairs from the row of the mixing table of particle i
+    __m256i types = _mm256_maskz_loadu_epi32(mask, &soa.typeIndex[j]);
+    types = _mm256_slli_epi32(types, 2);
+    __m512d epsilon24 = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, types, epsilon24I, sizeof(double));
+    __m512d sigmaSquared = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, types, sigmaSquaredI, sizeof(double));
+
+    __m512d sigLen = _mm512_maskz_div_pd(mask, sigmaSquared, lengthSqr);  // (sigma²/length²)
+    sigLen = _mm512_mul_pd(sigLen, _mm512_mul_pd(sigLen, sigLen));       // (sigma²/length²)³
+
+    __m512d scalar = _mm512_mul_pd(_mm512_maskz_div_pd(mask, epsilon24, lengthSqr),
+                                   _mm512_mul_pd(sigLen, _mm512_sub_pd(_mm512_mul_pd(two, sigLen), one)));
+
+    __m512d forceX = _mm512_mul_pd(scalar, dx);
+    __m512d forceY = _mm512_mul_pd(scalar, dy);
+    __m512d forceZ = _mm512_mul_pd(scalar, dz);
+    fxi = _mm512_add_pd(fxi, forceX);
+    fyi = _mm512_add_pd(fyi, forceY);
+    fzi = _mm512_add_pd(fzi, forceZ);
+    _mm512_mask_storeu_pd(&soa.fx[j], mask, _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, &soa.fx[j]), forceX));
+    _mm512_mask_storeu_pd(&soa.fy[j], mask, _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, &soa.fy[j]), forceY));
+    _mm512_mask_storeu_pd(&soa.fz[j], mask, _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, &soa.fz[j]), forceZ));
+  }
+
+  soa.fx[i] += horizontalSum(fxi);
+  soa.fy[i] += horizontalSum(fyi);
+  soa.fz[i] += horizontalSum(fzi);
+}
+#endif
+
+bool isSupported(KernelType type) {
+  switch (type) {
+    case KernelType::Scalar:
+      return true;
+#ifdef MOLSIM_X86_KERNELS
+    case KernelType::AVX2:
+      return __builtin_cpu_supports("avx2");
+    case KernelType::AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl");
+#endif
+    default:
+      return false;
+  }
+}
+
+KernelType detectKernelType() {
+  if (isSupported(KernelType::AVX512)) return KernelType::AVX512;
+  if (isSupported(KernelType::AVX2)) return KernelType::AVX2;
+  return KernelType::Scalar;
+}
+
+Kernel getKernel(KernelType type) {
+  if (!isSupported(type)) throw std::invalid_argument("The Lennard-Jones kernel is not supported on this CPU.");
+
+  switch (type) {
+#ifdef MOLSIM_X86_KERNELS
+    case KernelType::AVX2:
+      return avx2Kernel;
+    case KernelType::AVX512:
+      return avx512Kernel;
+#endif
+    default:
+      return scalarKernel;
+  }
+}
+
+const char *getName(KernelType type) {
+  switch (type) {
+    case KernelType::AVX2:
+      return "AVX2";
+    case KernelType::AVX512:
+      return "AVX-512";
+    default:
+      return "scalar";
+  }
+}
+
+}  // namespace LennardJonesKernels
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+
+#include "dataStructures/ParticleSoA.h"
+
+// The vectorized kernels rely on GCC/Clang function multiversioning and are only available on x86-64
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MOLSIM_X86_KERNELS
+#endif
+
+/**
+ * Kernels that apply the Lennard-Jones forces between one particle and a contiguous range of particles of a structure
+ * of arrays, e.g. all particles of a neighboring cell. Besides the scalar kernel there are AVX2 and AVX-512 kernels,
+ * which process 4 or 8 partners at once and mask out pairs beyond the cut off radius. The kernel is selected at runtime
+ * depending on the instruction sets the CPU supports, so the binary does not need to be compiled with -march flags.
+ */
+namespace LennardJonesKernels {
+
+/// The available kernels
+enum class KernelType { Scalar, AVX2, AVX512 };
+
+/**
+ * Applies the Lennard-Jones forces between particle i and every particle within [begin, end). Both sides receive the
+ * forces according to Newton's third law. The parameters of each pair are looked up in the precomputed mixing table
+ * of the particle types.
+ * @param soa The structure of arrays containing the particles
+ * @param i The index of the particle that interacts with the range, must not be within the range
+ * @param begin The first index of the range
+ * @param end The index after the last one of the range
+ * @param cutOffRadiusSquared Pairs at this squared distance or further apart are skipped
+ */
+using Kernel = void (*)(ParticleSoA &soa, size_t i, size_t begin, size_t end, double cutOffRadiusSquared);
+
+/**
+ * Scalar kernel, one pair at a time. Used as fallback and for the remainders of the vectorized kernels.
+ * @copydetails Kernel
+ */
+void scalarKernel(ParticleSoA &soa, size_t i, size_t begin, size_t end, double cutOffRadiusSquared);
+
+#ifdef MOLSIM_X86_KERNELS
+/**
+ * AVX2 kernel, 4 pairs at a time. Only call it if the CPU supports AVX2.
+ * @copydetails Kernel
+ */
+void avx2Kernel(ParticleSoA &soa, size_t i, size_t begin, size_t end, double cutOffRadiusSquared);
+
+/**
+ * AVX-512 kernel, 8 pairs at a time. Only call it if the CPU supports AVX-512F and AVX-512VL.
+ * @copydetails Kernel
+ */
+void avx512Kernel(ParticleSoA &soa, size_t i, size_t begin, size_t end, double cutOffRadiusSquared);
+#endif
+
+/**
+ * @param type The kernel type
+ * @return Whether the CPU and the build support the kernel type
+ */
+bool isSupported(KernelType type);
+
+/**
+ * @return The widest kernel type the CPU supports
+ */
+KernelType detectKernelType();
+
+/**
+ * @param type The kernel type, has to be supported
+ * @return The kernel of that type
+ */
+Kernel getKernel(KernelType type);
+
+/**
+ * @param type The kernel type
+ * @return The name of the kernel type for logging
+ */
+const char *getName(KernelType type);
+
+}  // namespace LennardJonesKernels
@@ -1,24 +1,29 @@
 #include "LennardJonesModel.h"
 
 #include "utils/ArrayUtils.h"
-using ArrayUtils::dotProduct;
 
-void LennardJonesModel::addForces(Particle &p1, Particle &p2) const {
-  double length_sqr = dotProduct(p1.x - p2.x);
+void LennardJonesModel::addForcesSoA(ParticleSoA &soa, size_t i, size_t j) const {
+  double dx = soa.x[i] - soa.x[j];
+  double dy = soa.y[i] - soa.y[j];
+  double dz = soa.z[i] - soa.z[j];
+  double length_sqr = dx * dx + dy * dy + dz * dz;
 
   if (length_sqr >= cutOffRadiusSquared) return;
 
-  // Calculate (sigma⁶/length⁶)
-  double sigma = p1.sigma == p2.sigma ? p1.sigma : (p1.sigma + p2.sigma) / 2;
-  double sig_len = sigma * sigma / length_sqr;  // (sigma²/length²)
-  sig_len *= sig_len * sig_len;                 // (sigma²/length²)³
+  auto &parameters = Particle::getPairParameters(soa.typeIndex[i], soa.typeIndex[j]);
+  double sig_len = parameters.sigmaSquared / length_sqr;  // (sigma²/length²)
+  sig_len *= sig_len * sig_len;                           // (sigma²/length²)³
 
-  // This is the force formula from worksheet 2 slightly reformulated for better numerical accuracy.
-  double epsilon = p1.epsilon == p2.epsilon ? p1.epsilon : std::sqrt(p1.epsilon * p2.epsilon);
-  auto force = ((-24 * epsilon) / length_sqr) * (sig_len * (1 - (2 * sig_len))) * (p1.x - p2.x);
+  double scalar = (-parameters.epsilon24 / length_sqr) * (sig_len * (1 - (2 * sig_len)));
 
-  p1.applySymmetricForce(p2, force);
+  soa.fx[i] += scalar * dx;
+  soa.fy[i] += scalar * dy;
+  soa.fz[i] += scalar * dz;
+  soa.fx[j] -= scalar * dx;
+  soa.fy[j] -= scalar * dy;
+  soa.fz[j] -= scalar * dz;
 }
+
 void LennardJonesModel::setCutOffRadius(double cutOffRadius) {
   LennardJonesModel::cutOffRadiusSquared = cutOffRadius * cutOffRadius;
 }
@@ -8,6 +8,39 @@ class LennardJonesModel : public IModel {
   size_t hits{};
   size_t comparisons{};
 
+  /**
+   * Calculates the scalar that the distance vector x_1 - x_2 gets multiplied with to get the force p2 applies upon p1.
+   * @param p1 The particle that gets influenced by particle p2
+   * @param p2 The particle that influences particle p1
+   * @param length_sqr The squared distance between both particles
+   * @return The force scalar
+   */
+  double calculateForceScalar(Particle const &p1, Particle const &p2, double length_sqr) const {
+    auto &parameters = Particle::getPairParameters(p1.typeIndex, p2.typeIndex);
+
+    // Calculate (sigma⁶/length⁶)
+    double sig_len = parameters.sigmaSquared / length_sqr;  // (sigma²/length²)
+    sig_len *= sig_len * sig_len;                           // (sigma²/length²)³
+
+    // This is the force formula from worksheet 2 slightly reformulated for better numerical accuracy.
+    return (-parameters.epsilon24 / length_sqr) * (sig_len * (1 - (2 * sig_len)));
+  }
+
+  /**
+   * Calculates the Lennard-Jones potential of two particles
+   * @param p1 The first particle
+   * @param p2 The second particle
+   * @param length_sqr The squared distance between both particles
+   * @return The potential energy of the pair
+   */
+  double calculatePotential(Particle const &p1, Particle const &p2, double length_sqr) const {
+    auto &parameters = Particle::getPairParameters(p1.typeIndex, p2.typeIndex);
+    double sig_len = parameters.sigmaSquared / length_sqr;
+    sig_len *= sig_len * sig_len;
+
+    return 4 * parameters.epsilon * sig_len * (sig_len - 1);
+  }
+
  public:
   void setCutOffRadius(double cutOffRadius);
 
@@ -26,8 +59,65 @@ class LennardJonesModel : public IModel {
    * Lennard-Jones potential.
    * @param p1 The particle which influences particle p2
    * @param p2 The particle which influences particle p1
+   * @note Defined in the header, so that it can be inlined into the pair loops of the containers
+   */
+  void addForces(Particle &p1, Particle &p2) const override {
+    double length_sqr = ArrayUtils::dotProduct(p1.x - p2.x);
+
+    if (length_sqr >= cutOffRadiusSquared) return;
+
+    auto force = calculateForceScalar(p1, p2, length_sqr) * (p1.x - p2.x);
+    p1.f = p1.f + force;
+    p2.f = p2.f - force;
+  }
+
+  /**
+   * Add the forces of both particles like addForces and the potential energy and virial of the pair onto the
+   * observables
+   * @param p1 The particle which influences particle p2
+   * @param p2 The particle which influences particle p1
+   * @param observables The observables of the calling thread
+   */
+  void addForcesAndObservables(Particle &p1, Particle &p2, PairObservables &observables) const override {
+    double length_sqr = ArrayUtils::dotProduct(p1.x - p2.x);
+
+    if (length_sqr >= cutOffRadiusSquared) return;
+
+    double scalar = calculateForceScalar(p1, p2, length_sqr);
+    auto force = scalar * (p1.x - p2.x);
+    p1.f = p1.f + force;
+    p2.f = p2.f - force;
+
+    observables.potentialEnergy += calculatePotential(p1, p2, length_sqr);
+    observables.virial += scalar * length_sqr;
+  }
+
+  /**
+   * Calculates the force p2 applies upon p1 based on the Lennard-Jones potential.
+   * @param p1 The particle that gets influenced by particle p2
+   * @param p2 The particle that influences particle p1
+   * @return The force acting upon p1, zero beyond the cut off radius
+   */
+  std::array<double, 3> calculateForce(Particle &p1, Particle &p2) const override {
+    double length_sqr = ArrayUtils::dotProduct(p1.x - p2.x);
+
+    if (length_sqr >= cutOffRadiusSquared) return {0., 0., 0.};
+
+    return calculateForceScalar(p1, p2, length_sqr) * (p1.x - p2.x);
+  }
+
+  /**
+   * Add the forces both particles of a structure of arrays apply upon each other based on the Lennard-Jones potential.
+   * @param soa The structure of arrays containing both particles
+   * @param i The index of the particle which influences particle j
+   * @param j The index of the particle which influences particle i
+   */
+  void addForcesSoA(ParticleSoA &soa, size_t i, size_t j) const override;
+
+  /**
+   * @return The squared cut off radius
    */
-  void addForces(Particle &p1, Particle &p2) const override;
+  [[nodiscard]] double getCutOffRadiusSquared() const { return cutOffRadiusSquared; }
 
   size_t getHits() const override { return hits; };
 
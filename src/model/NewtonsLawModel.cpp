@@ -5,7 +5,24 @@ using ArrayUtils::L2Norm;
 #include <cmath>
 
 void NewtonsLawModel::addForces(Particle &p1, Particle &p2) const {
-  auto force = ((p1.m * p2.m) / pow(L2Norm(p1.x - p2.x), 3)) * (p2.x - p1.x);
+  auto force = NewtonsLawModel::calculateForce(p1, p2);
   p1.f = p1.f + force;
   p2.f = p2.f - force;  // Netwon's 3rd law
-}
\ No newline at end of file
+}
+
+std::array<double, 3> NewtonsLawModel::calculateForce(Particle &p1, Particle &p2) const {
+  return ((p1.m * p2.m) / pow(L2Norm(p1.x - p2.x), 3)) * (p2.x - p1.x);
+}
+void NewtonsLawModel::addForcesSoA(ParticleSoA &soa, size_t i, size_t j) const {
+  double dx = soa.x[j] - soa.x[i];
+  double dy = soa.y[j] - soa.y[i];
+  double dz = soa.z[j] - soa.z[i];
+  double scalar = (soa.m[i] * soa.m[j]) / pow(std::sqrt(dx * dx + dy * dy + dz * dz), 3);
+
+  soa.fx[i] += scalar * dx;
+  soa.fy[i] += scalar * dy;
+  soa.fz[i] += scalar * dz;
+  soa.fx[j] -= scalar * dx;
+  soa.fy[j] -= scalar * dy;
+  soa.fz[j] -= scalar * dz;
+}
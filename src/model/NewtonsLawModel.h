@@ -11,4 +11,20 @@ class NewtonsLawModel : public IModel {
    * @param p2 The particle which influences particle p1
    */
   void addForces(Particle &p1, Particle &p2) const override;
+
+  /**
+   * Calculates the force p2 applies upon p1 according to Newton's law of gravity.
+   * @param p1 The particle that gets influenced by particle p2
+   * @param p2 The particle that influences particle p1
+   * @return The force acting upon p1
+   */
+  std::array<double, 3> calculateForce(Particle &p1, Particle &p2) const override;
+
+  /**
+   * Add the forces both particles of a structure of arrays apply upon each other according to Newton's law of gravity.
+   * @param soa The structure of arrays containing both particles
+   * @param i The index of the particle which influences particle j
+   * @param j The index of the particle which influences particle i
+   */
+  void addForcesSoA(ParticleSoA &soa, size_t i, size_t j) const override;
 };
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/// Potential energy and virial of the pairs a force calculation visited
+struct PairObservables {
+  /// Sum of the potential energies of all pairs
+  double potentialEnergy{0.};
+
+  /// Sum of r_ij * F_ij over all pairs, with r_ij = x_i - x_j and F_ij the force particle j applies upon particle i
+  double virial{0.};
+};
+
+/**
+ * Collects the pair observables of a force calculation. Each thread adds to its own slot, the slots are summed up after
+ * the force calculation.
+ */
+class PairObservablesAccumulator {
+ private:
+  /// Padded to a cache line, so that the threads do not write to the same line
+  struct alignas(64) Slot {
+    PairObservables observables;
+  };
+
+  std::vector<Slot> slots;
+
+  /// The sum of all slots after the last force calculation
+  PairObservables total;
+
+  /// Whether total holds the result of a force calculation that was not consumed yet
+  bool hasResult{false};
+
+ public:
+  /**
+   * Resets the slots, call before the force calculation
+   */
+  void begin() {
+#ifdef _OPENMP
+    slots.assign(omp_get_max_threads(), Slot{});
+#else
+    slots.assign(1, Slot{});
+#endif
+  }
+
+  /**
+   * @return The slot of the calling thread
+   */
+  PairObservables &local() {
+#ifdef _OPENMP
+    return slots[omp_get_thread_num()].observables;
+#else
+    return slots[0].observables;
+#endif
+  }
+
+  /**
+   * Sums up the slots, call after the force calculation
+   */
+  void end() {
+    total = {};
+    for (auto &slot : slots) {
+      total.potentialEnergy += slot.observables.potentialEnergy;
+      total.virial += slot.observables.virial;
+    }
+    hasResult = true;
+  }
+
+  /**
+   * Returns the observables of the last force calculation and clears them
+   * @param result Receives the observables
+   * @return Whether there was a force calculation since the last call
+   */
+  bool take(PairObservables &result) {
+    if (!hasResult) return false;
+
+    result = total;
+    hasResult = false;
+    return true;
+  }
+};
@@ -1,4 +1,6 @@
 #pragma once
+#include <cmath>
+
 #include "IModel.h"
 
 class SmoothedLennardJonesModel : public IModel {
@@ -6,26 +8,119 @@ class SmoothedLennardJonesModel : public IModel {
   double radius_c;
   double radius_l;
 
+  /// radius_c², pairs at this squared distance or further apart do not interact
+  double radiusCSquared;
+
+  /// radius_l², up to this squared distance the plain Lennard-Jones force applies
+  double radiusLSquared;
+
+  /// 3 * radius_c - radius_l, a factor of the smoothing function
+  double smoothingOffset;
+
+  /// 1 / (radius_c - radius_l)³, the normalization of the smoothing function
+  double inverseRadialDiffCubed;
+
   size_t hits{};
   size_t comparisons{};
 
+  /**
+   * Calculates the scalar that the distance vector x_i - x_j of two particles gets multiplied with to get the force
+   * particle j applies upon particle i. With the potential V = V_LJ * S and the smoothing function
+   * S(d) = 1 - (d - r_l)² (3 r_c - r_l - 2 d) / (r_c - r_l)³ this is -V'(d) / d = F_LJ * S - V_LJ * S'(d) / d with
+   * S'(d) = -6 (d - r_l) (r_c - d) / (r_c - r_l)³. Only the smoothing range needs the distance itself, below radius_l
+   * everything is calculated from the squared distance.
+   * @param length_sqr The squared distance between both particles
+   * @param parameters The mixed parameters of both particles
+   * @return The force scalar
+   */
+  double calculateForceScalar(double length_sqr, const Particle::PairParameters &parameters) const {
+    if (length_sqr >= radiusCSquared) return 0.;
+
+    double sig_len = parameters.sigmaSquared / length_sqr;  // (sigma²/length²)
+    sig_len *= sig_len * sig_len;                           // (sigma²/length²)³
+    double scalar = (parameters.epsilon24 / length_sqr) * (sig_len * ((2 * sig_len) - 1));
+    if (length_sqr <= radiusLSquared) return scalar;
+
+    double distance = std::sqrt(length_sqr);
+    double fromL = distance - radius_l;
+    double smoothing = 1 - fromL * fromL * (smoothingOffset - 2 * distance) * inverseRadialDiffCubed;
+    // 6 * V_LJ = 24 * epsilon * sig_len * (sig_len - 1)
+    double sixPotential = parameters.epsilon24 * sig_len * (sig_len - 1);
+    return scalar * smoothing + sixPotential * fromL * (radius_c - distance) * inverseRadialDiffCubed / distance;
+  }
+
+  /**
+   * Calculates the potential of two particles: the Lennard-Jones potential up to radius_l, multiplied with a cubic
+   * smoothing function that decreases to zero at the cut off radius
+   * @param length_sqr The squared distance between both particles
+   * @param parameters The mixed parameters of both particles
+   * @return The potential energy of the pair
+   */
+  double calculatePotential(double length_sqr, const Particle::PairParameters &parameters) const;
+
  public:
   /**
    * Instantiates a force calculation model based on the SmoothedLennardJonesModel
    * @param cutOffRadius The max distance between two particles where forces are applied, greater distances between
    * particles have the force 0
-   * @param radius_l
+   * @param radius_l The distance from which on the potential is smoothed towards zero at the cut off radius
    */
   explicit SmoothedLennardJonesModel(double cutOffRadius, double radius_l)
-      : radius_c{cutOffRadius}, radius_l{radius_l} {};
+      : radius_c{cutOffRadius},
+        radius_l{radius_l},
+        radiusCSquared{cutOffRadius * cutOffRadius},
+        radiusLSquared{radius_l * radius_l},
+        smoothingOffset{3 * cutOffRadius - radius_l},
+        inverseRadialDiffCubed{1 / std::pow(cutOffRadius - radius_l, 3)} {};
   ~SmoothedLennardJonesModel() = default;
 
   /**
    * Add the forces both particles apply upon each based on the Smoothed Lennard-Jones potential.
    * @param p1 The particle which influences particle p2
    * @param p2 The particle which influences particle p1
+   * @note Defined in the header, so that it can be inlined into the pair loops of the containers
+   */
+  void addForces(Particle &p1, Particle &p2) const override {
+    auto distance = p1.x - p2.x;
+    double length_sqr = ArrayUtils::dotProduct(distance);
+    if (length_sqr >= radiusCSquared) return;
+
+    auto force = calculateForceScalar(length_sqr, Particle::getPairParameters(p1.typeIndex, p2.typeIndex)) * distance;
+    p1.f = p1.f + force;
+    p2.f = p2.f - force;
+  }
+
+  /**
+   * Add the forces of both particles like addForces and the potential energy and virial of the pair onto the
+   * observables
+   * @param p1 The particle which influences particle p2
+   * @param p2 The particle which influences particle p1
+   * @param observables The observables of the calling thread
+   */
+  void addForcesAndObservables(Particle &p1, Particle &p2, PairObservables &observables) const override;
+
+  /**
+   * Calculates the force p2 applies upon p1 based on the Smoothed Lennard-Jones potential.
+   * @param p1 The particle that gets influenced by particle p2
+   * @param p2 The particle that influences particle p1
+   * @return The force acting upon p1
+   */
+  std::array<double, 3> calculateForce(Particle &p1, Particle &p2) const override {
+    auto distance = p1.x - p2.x;
+    double length_sqr = ArrayUtils::dotProduct(distance);
+    if (length_sqr >= radiusCSquared) return {0., 0., 0.};
+
+    return calculateForceScalar(length_sqr, Particle::getPairParameters(p1.typeIndex, p2.typeIndex)) * distance;
+  }
+
+  /**
+   * Add the forces both particles of a structure of arrays apply upon each other based on the Smoothed Lennard-Jones
+   * potential.
+   * @param soa The structure of arrays containing both particles
+   * @param i The index of the particle which influences particle j
+   * @param j The index of the particle which influences particle i
    */
-  void addForces(Particle &p1, Particle &p2) const override;
+  void addForcesSoA(ParticleSoA &soa, size_t i, size_t j) const override;
 
   size_t getHits() const { return hits; }
   size_t getComparisons() const { return comparisons; }
@@ -60,17 +60,12 @@ void Thermostat::setTemperature(double currentTemperature, double newTemperature
   double scaleFactor = sqrt(newTemperature / currentTemperature);
   std::function<void(Particle &)> scaleVelocity = [scaleFactor](Particle &p) { p.v = scaleFactor * p.v; };
 
-  particleContainer.forEach(scaleVelocity);
+  particleContainer.forEachParallel(scaleVelocity);
 }
 
 double Thermostat::computeEnergy() {
-  double energy{0.};
-  std::function<void(Particle &)> energyCalc = [&energy](Particle &p) {
-    energy += (p.m * ArrayUtils::dotProduct(p.v)) / 2.;
-  };
-  particleContainer.forEach(energyCalc);
-
-  return energy;
+  std::function<double(Particle &)> energyCalc = [](Particle &p) { return (p.m * ArrayUtils::dotProduct(p.v)) / 2.; };
+  return particleContainer.reduceSum(energyCalc);
 }
 
 double Thermostat::getCurrentTemperature() {
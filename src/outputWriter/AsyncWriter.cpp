@@ -0,0 +1,93 @@
+#include "AsyncWriter.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "spdlog/spdlog.h"
+
+AsyncWriter::AsyncWriter(std::unique_ptr<IWriter> writer, size_t queueDepth)
+    : writer{std::move(writer)}, queueDepth{queueDepth} {
+  if (queueDepth == 0) throw std::invalid_argument("The queue depth of the asynchronous writer must be at least 1.");
+  writerThread = std::thread(&AsyncWriter::run, this);
+}
+
+AsyncWriter::~AsyncWriter() {
+  {
+    std::unique_lock lock(mutex);
+    queueChanged.wait(lock, [this] { return queue.empty() && !writing; });
+    stopping = true;
+  }
+  queueChanged.notify_all();
+  writerThread.join();
+
+  if (error) spdlog::error("Writing the output failed, the last files may be missing.");
+}
+
+void AsyncWriter::writeFile(const std::string &filename, int iteration, IContainer &particles) {
+  std::unique_ptr<VectorContainer> snapshot;
+  {
+    std::unique_lock lock(mutex);
+    rethrowError();
+    if (queue.size() >= queueDepth) {
+      spdlog::debug("Output queue is full, waiting for the writer thread.");
+      queueChanged.wait(lock, [this] { return queue.size() < queueDepth || error; });
+      rethrowError();
+    }
+
+    if (freeSnapshots.empty()) {
+      snapshot = std::make_unique<VectorContainer>();
+    } else {
+      snapshot = std::move(freeSnapshots.back());
+      freeSnapshots.pop_back();
+    }
+  }
+
+  // The snapshot is only accessed by this thread until it is queued
+  auto &snapshotParticles = snapshot->getParticlesRef();
+  snapshotParticles.clear();
+  snapshotParticles.reserve(particles.size());
+  std::function<void(Particle &)> copy{[&snapshotParticles](Particle &p) { snapshotParticles.push_back(p); }};
+  particles.forEach(copy);
+
+  {
+    std::lock_guard lock(mutex);
+    queue.push_back({filename, iteration, std::move(snapshot)});
+  }
+  queueChanged.notify_all();
+}
+
+void AsyncWriter::flush() {
+  std::unique_lock lock(mutex);
+  queueChanged.wait(lock, [this] { return (queue.empty() && !writing) || error; });
+  rethrowError();
+}
+
+void AsyncWriter::run() {
+  std::unique_lock lock(mutex);
+  while (true) {
+    queueChanged.wait(lock, [this] { return !queue.empty() || stopping; });
+    if (queue.empty()) return;
+
+    auto job = std::move(queue.front());
+    queue.pop_front();
+    writing = true;
+    lock.unlock();
+
+    std::exception_ptr jobError;
+    try {
+      writer->writeFile(job.filename, job.iteration, *job.snapshot);
+    } catch (...) {
+      jobError = std::current_exception();
+    }
+
+    lock.lock();
+    if (jobError && !error) error = jobError;
+    writing = false;
+    freeSnapshots.push_back(std::move(job.snapshot));
+    queueChanged.notify_all();
+  }
+}
+
+void AsyncWriter::rethrowError() {
+  if (error) std::rethrow_exception(std::exchange(error, nullptr));
+}
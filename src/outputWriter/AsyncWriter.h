@@ -0,0 +1,88 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "IWriter.h"
+#include "dataStructures/VectorContainer.h"
+
+/**
+ * Decorator that moves the output of another writer onto a background thread. On writeFile the particles are copied
+ * into a snapshot and the simulation continues while the writer thread serializes the snapshot. The snapshots are
+ * reused, so after the first outputs no memory gets allocated. If the writer thread falls behind by more than the
+ * queue depth, writeFile blocks until a snapshot was written.
+ */
+class AsyncWriter : public IWriter {
+ private:
+  /// A snapshot that waits to be written
+  struct Job {
+    std::string filename;
+    int iteration;
+    std::unique_ptr<VectorContainer> snapshot;
+  };
+
+  /// The writer that serializes the snapshots
+  std::unique_ptr<IWriter> writer;
+
+  /// The maximum number of snapshots waiting to be written
+  size_t queueDepth;
+
+  /// The snapshots waiting to be written, in the order of writeFile calls
+  std::deque<Job> queue;
+
+  /// Snapshots that were written and can be reused
+  std::vector<std::unique_ptr<VectorContainer>> freeSnapshots;
+
+  /// Whether the writer thread is currently writing a snapshot
+  bool writing{false};
+
+  /// Set on destruction to stop the writer thread
+  bool stopping{false};
+
+  /// The first exception thrown by the writer, rethrown on the simulation thread
+  std::exception_ptr error;
+
+  std::mutex mutex;
+
+  /// Notified whenever a job is added or finished
+  std::condition_variable queueChanged;
+
+  std::thread writerThread;
+
+  /**
+   * Writes the queued snapshots until the writer is destroyed
+   */
+  void run();
+
+  /**
+   * Rethrows the exception of the writer thread, if there is one
+   * @note The mutex has to be held
+   */
+  void rethrowError();
+
+ public:
+  /**
+   * @param writer The writer that serializes the snapshots
+   * @param queueDepth The maximum number of snapshots waiting to be written, has to be at least 1
+   */
+  explicit AsyncWriter(std::unique_ptr<IWriter> writer, size_t queueDepth = 2);
+
+  /**
+   * Waits for all queued snapshots to be written
+   */
+  ~AsyncWriter() override;
+
+  /**
+   * Copies the particles into a snapshot and queues it to be written by the writer thread
+   * @param filename Passed on to the writer
+   * @param iteration Passed on to the writer
+   * @param particles The particles, they can be modified as soon as the method returns
+   * @throws Rethrows exceptions the writer threw for earlier snapshots
+   */
+  void writeFile(const std::string &filename, int iteration, IContainer &particles) override;
+
+  void flush() override;
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Layout of the binary checkpoint files. A file consists of
+ * - one Header
+ * - Header::typeCount TypeRecords, the registered particle types
+ * - Header::structureCount StructureRecords, the membranes
+ * - Header::particleCount ParticleRecords
+ * All sections are written as they are in memory, so a file can only be read on machines with the same byte order,
+ * which is checked via Header::byteOrderMark. Every record has a size that is a multiple of 8 bytes, so all records of
+ * a memory mapped file are aligned.
+ */
+namespace CheckpointBinaryFormat {
+
+/// The first bytes of each binary checkpoint file
+constexpr std::array<char, 8> magic{'M', 'O', 'L', 'S', 'I', 'M', 'C', 'P'};
+
+/// Has to be increased whenever the layout of one of the records changes
+constexpr std::uint32_t version = 1;
+
+/// Written as is, reads differently on machines with another byte order
+constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+/// Files with this extension are written in the binary format
+constexpr std::string_view fileExtension = ".bin";
+
+struct Header {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byteOrderMark;
+  std::uint64_t particleCount;
+  std::uint64_t typeCount;
+  std::uint64_t structureCount;
+  /// 1 if the particles were stored by a linked cells container, in that case the domain fields are set
+  std::uint64_t hasDomain;
+  std::array<double, 3> leftLowerCorner;
+  std::array<double, 3> rightUpperCorner;
+  double cellSize;
+};
+
+struct TypeRecord {
+  std::int64_t type;
+  double epsilon;
+  double sigma;
+};
+
+struct StructureRecord {
+  std::array<std::uint64_t, 3> dimensions;
+  /// Index of the first particle of the membrane within the particle records
+  std::uint64_t startIndex;
+  double stiffness;
+  double bondLength;
+  double cutOff;
+};
+
+struct ParticleRecord {
+  std::array<double, 3> x;
+  std::array<double, 3> v;
+  std::array<double, 3> f;
+  std::array<double, 3> oldF;
+  std::array<double, 3> lastPosition;
+  double m;
+  double epsilon;
+  double sigma;
+  std::int32_t type;
+  std::array<std::int32_t, 3> periodicBoundariesCrossed;
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) % 8 == 0);
+static_assert(std::is_trivially_copyable_v<TypeRecord> && sizeof(TypeRecord) % 8 == 0);
+static_assert(std::is_trivially_copyable_v<StructureRecord> && sizeof(StructureRecord) % 8 == 0);
+static_assert(std::is_trivially_copyable_v<ParticleRecord> && sizeof(ParticleRecord) % 8 == 0);
+
+}  // namespace CheckpointBinaryFormat
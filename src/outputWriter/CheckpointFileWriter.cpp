@@ -3,7 +3,18 @@
 #include <iostream>
 #include <utility>
 
+#include "CheckpointBinaryFormat.h"
+#include "dataStructures/LinkedCellsContainer.h"
+#include "spdlog/spdlog.h"
+
 void CheckpointFileWriter::writeFile(const std::string& filename, int iteration, IContainer& particles) {
+  if (isBinaryPath(filename)) {
+    file.open(filename, std::ios::out | std::ios::binary);
+    writeBinaryFile(particles);
+    file.close();
+    return;
+  }
+
   file.open(filename, std::ios::out);
   std::function<void(Particle&)> plot{[this](Particle& p) { this->checkpointParticle(p); }};
   writeFile(particles.size());
@@ -49,6 +60,77 @@ void CheckpointFileWriter::checkpointParticle(const Particle& p) {
   }
 }
 
+void CheckpointFileWriter::writeBinaryFile(IContainer& particles) {
+  using namespace CheckpointBinaryFormat;
+  auto& particlesVector = particles.getParticlesRef();
+
+  // The membranes refer to ranges of the particles vector, which shift when deleted particles are skipped
+  std::vector<ParticleRecord> particleRecords;
+  std::vector<size_t> recordIndices(particlesVector.size());
+  particleRecords.reserve(particlesVector.size());
+  for (size_t i = 0; i < particlesVector.size(); ++i) {
+    auto& p = particlesVector[i];
+    recordIndices[i] = particleRecords.size();
+    if (p.isDeleted()) continue;
+
+    auto& history = particles.getHistory(p);
+    auto& crossed = history.periodicBoundariesCrossed;
+    particleRecords.push_back({p.getX(), p.getV(), p.getF(), p.getOldF(), history.lastPosition, p.getM(),
+                               p.getEpsilon(), p.getSigma(), p.getType(), {crossed[0], crossed[1], crossed[2]}});
+  }
+
+  std::vector<StructureRecord> structureRecords;
+  if (particles.containsStructures()) {
+    for (auto& membrane : particles.getStructureVectorRef()) {
+      size_t start = recordIndices[membrane.getStartIndex()];
+      size_t end = membrane.getStartIndex() + membrane.size();
+      if ((end == recordIndices.size() ? particleRecords.size() : recordIndices[end]) - start != membrane.size()) {
+        spdlog::warn("A membrane lost particles and is not written to the checkpoint.");
+        continue;
+      }
+
+      auto dimensions = membrane.getDimensions();
+      structureRecords.push_back({{dimensions[0], dimensions[1], dimensions[2]},
+                                  start,
+                                  membrane.getStiffness(),
+                                  membrane.getBondLength(),
+                                  membrane.getHarmonicCutOff()});
+    }
+  }
+
+  std::vector<TypeRecord> typeRecords;
+  for (auto& [type, parameters] : Particle::getRegisteredParticleTypes())
+    typeRecords.push_back({type, parameters.epsilon, parameters.sigma});
+
+  Header header{};
+  header.magic = magic;
+  header.version = version;
+  header.byteOrderMark = byteOrderMark;
+  header.particleCount = particleRecords.size();
+  header.typeCount = typeRecords.size();
+  header.structureCount = structureRecords.size();
+  if (auto* linkedCells = dynamic_cast<LinkedCellsContainer*>(&particles)) {
+    header.hasDomain = 1;
+    header.leftLowerCorner = linkedCells->getLeftLowerCorner();
+    header.rightUpperCorner = linkedCells->getRightUpperCorner();
+    header.cellSize = linkedCells->getGridSize();
+  }
+
+  auto writeSection = [this](const auto& records) {
+    file.write(reinterpret_cast<const char*>(records.data()),
+               static_cast<std::streamsize>(records.size() * sizeof(records[0])));
+  };
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  writeSection(typeRecords);
+  writeSection(structureRecords);
+  writeSection(particleRecords);
+  file.flush();
+}
+
+bool CheckpointFileWriter::isBinaryPath(const std::string& filename) {
+  return filename.ends_with(CheckpointBinaryFormat::fileExtension);
+}
+
 CheckpointFileWriter::CheckpointFileWriter(std::string outputFile) : outputFile{std::move(outputFile)} {}
 
 const std::string& CheckpointFileWriter::getOutputFile() const { return outputFile; }
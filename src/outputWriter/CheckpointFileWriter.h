@@ -13,8 +13,9 @@ class CheckpointFileWriter : public IWriter {
    */
   CheckpointFileWriter(std::string outputFile);
   /**
-   * Writes the checkpoint of each particle into the path file
-   * @param filename unused
+   * Writes the checkpoint of each particle into the path file. Files ending with .bin are written in the binary format
+   * described in CheckpointBinaryFormat.h, all others as text.
+   * @param filename The path of the checkpoint file
    * @param iteration unused
    * @param particles
    */
@@ -24,6 +25,12 @@ class CheckpointFileWriter : public IWriter {
 
   ~CheckpointFileWriter();
 
+  /**
+   * @param filename The path of a checkpoint file
+   * @return Whether the checkpoint gets written in the binary format
+   */
+  static bool isBinaryPath(const std::string &filename);
+
  private:
   /**
    * Writes the data of each particle into the path file
@@ -35,4 +42,11 @@ class CheckpointFileWriter : public IWriter {
    * @param size
    */
   void writeFile(size_t size);
+
+  /**
+   * Writes the particle types, membranes and particles in the binary format. Each section is written at once.
+   * Deleted particles are skipped.
+   * @param particles
+   */
+  void writeBinaryFile(IContainer &particles);
 };
\ No newline at end of file
@@ -18,4 +18,10 @@ class IWriter {
    * @param particles The particle container with all particles
    */
   virtual void writeFile(const std::string &filename, int iteration, IContainer &particles) = 0;
+
+  /**
+   * Blocks until all files passed to writeFile are completely written. Writers that write synchronously have nothing
+   * to do here.
+   */
+  virtual void flush() {}
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <iostream>
 
+#include "spdlog/spdlog.h"
 #include "utils/ThermodynamicStatistics.h"
 #define START 1
 #define END 50
@@ -29,7 +30,9 @@ void StatisticsWriter::writeFile(size_t size) {
           "# Molecule data consists of\n"
           "# * iteration (integer value)\n"
           "# * calculateVariance (double value)\n"
-          "# * calculateRadialDistributionFunction (vector of double values)\n";
+          "# * calculateRadialDistributionFunction (vector of double values)\n"
+          "# * potential energy, virial and pressure (double values). Models without a potential report 0.\n"
+          "#   The pressure is only written for linked cells containers, whose domain defines the volume.\n";
   file << size << " Particles"
        << "\n";
 }
@@ -42,9 +45,27 @@ void StatisticsWriter::registerParticle(int iteration) {
 
     file << stat.calculateVariance(&particleContainer) << "\n"
          << "RDF: ";
-    file << ThermodynamicStatistics::calculateRadialDistributionFunction(rdfDeltaR, &particleContainer, rdfStart,
-                                                                         rdfEnd)
-         << "\n";
+    std::vector<double> densities;
+    if (!rdfObserver || !rdfObserver->takeDensities(densities))
+      densities = ThermodynamicStatistics::calculateRadialDistributionFunction(rdfDeltaR, &particleContainer, rdfStart,
+                                                                               rdfEnd);
+    file << densities << "\n";
+
+    PairObservables observables;
+    if (pairObservables.take(observables)) {
+      file << "Epot: " << observables.potentialEnergy << "\n"
+           << "Virial: " << observables.virial << "\n";
+
+      if (auto *linkedCells = dynamic_cast<LinkedCellsContainer *>(&particleContainer)) {
+        auto domain = linkedCells->getRightUpperCorner() - linkedCells->getLeftLowerCorner();
+        std::function<double(Particle &)> kineticEnergy{
+            [](Particle &p) { return 0.5 * p.getM() * ArrayUtils::dotProduct(p.getV()); }};
+        file << "Pressure: "
+             << calculatePressure(particleContainer.reduceSum(kineticEnergy), observables.virial,
+                                  domain[0] * domain[1] * domain[2])
+             << "\n";
+      }
+    }
     file << "\n";
   }
 }
@@ -60,6 +81,20 @@ StatisticsWriter::StatisticsWriter(IContainer& particleContainer, int frequency,
   const char* fn = filename.c_str();
   remove(fn);
 }
+void StatisticsWriter::enablePairObservation(double cutOffRadius) {
+  auto observer = std::make_unique<RadialDistributionObserver>(rdfDeltaR, rdfStart, rdfEnd);
+  if (observer->getMaxDistance() > cutOffRadius) {
+    spdlog::info("The rdf reaches beyond the cut off radius, so it is computed in a separate pass.");
+    return;
+  }
+
+  rdfObserver = std::move(observer);
+}
+
+double StatisticsWriter::calculatePressure(double kineticEnergy, double virial, double volume) {
+  return (2 * kineticEnergy + virial) / (3 * volume);
+}
+
 int StatisticsWriter::getFrequency() const { return frequency; }
 const std::string& StatisticsWriter::getFilename() const { return filename; }
 
@@ -1,8 +1,11 @@
 #pragma once
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 #include "IWriter.h"
+#include "model/PairObservables.h"
+#include "utils/RadialDistributionObserver.h"
 #include "utils/ThermodynamicStatistics.h"
 
 class StatisticsWriter : public IWriter {
@@ -16,6 +19,12 @@ class StatisticsWriter : public IWriter {
   double rdfStart;
   double rdfEnd;
 
+  /// Accumulates the rdf during the force calculation, null if the rdf is computed in a separate pass
+  std::unique_ptr<RadialDistributionObserver> rdfObserver;
+
+  /// The potential energy and virial the model accumulated during the force calculation of the statistics iteration
+  PairObservablesAccumulator pairObservables;
+
  private:
   /**
    * Writes the statistics file header and number of particles into the file
@@ -49,6 +58,34 @@ class StatisticsWriter : public IWriter {
    */
   void writeFile(const std::string &filename, int iteration, IContainer &particles) override;
 
+  /**
+   * Accumulates the rdf during the force calculation instead of in a separate pass over the pairs, if the force
+   * calculation visits all pairs the rdf needs
+   * @param cutOffRadius All pairs within this distance are visited by the force calculation
+   */
+  void enablePairObservation(double cutOffRadius);
+
+  /**
+   * @return The observer that has to see the pairs of the force calculation of each statistics iteration, null if the
+   * statistics do not need the pairs
+   */
+  IPairObserver *getPairObserver() { return rdfObserver.get(); }
+
+  /**
+   * @return The accumulator the model adds the potential energy and virial onto during the force calculation of each
+   * statistics iteration
+   */
+  PairObservablesAccumulator &getPairObservables() { return pairObservables; }
+
+  /**
+   * Calculates the pressure via the virial theorem, P = (2 * E_kin + W) / (3 * V)
+   * @param kineticEnergy The kinetic energy of all particles
+   * @param virial The virial W of all pairs
+   * @param volume The volume of the domain
+   * @return The pressure
+   */
+  static double calculatePressure(double kineticEnergy, double virial, double volume);
+
   int getFrequency() const;
 
   const std::string &getFilename() const;
@@ -7,55 +7,32 @@
 
 #include "VTKWriter.h"
 
-#include <fstream>
+#include <bit>
 #include <iomanip>
 #include <iostream>
 #include <string>
 
 #include "spdlog/spdlog.h"
 
+namespace {
+/// Each data array in the appended section is preceded by its size in bytes of this type
+using HeaderType = std::uint64_t;
+}  // namespace
+
 VTKWriter::VTKWriter() = default;
 
 VTKWriter::~VTKWriter() = default;
 
 void VTKWriter::writeFile(const std::string &filename, int iteration, IContainer &particles) {
-  initializeOutput(static_cast<int>(particles.size()));
+  initializeOutput();
   std::function<void(Particle &)> plot{[this](Particle &p) { this->plotParticle(p); }};
   particles.forEach(plot);
   writeFile(filename, iteration);
 }
 
-void VTKWriter::initializeOutput(int numParticles) {
-  vtkFile = new VTKFile_t("UnstructuredGrid");
-
-  // per point, we add type, position, velocity and force
-  PointData pointData;
-  DataArray_t mass(type::Float32, "mass", 1);
-  DataArray_t sigma(type::Float32, "sigma", 1);
-  DataArray_t velocity(type::Float32, "velocity", 3);
-  DataArray_t forces(type::Float32, "force", 3);
-  DataArray_t type(type::Int32, "type", 1);
-  pointData.DataArray().push_back(mass);
-  pointData.DataArray().push_back(sigma);
-  pointData.DataArray().push_back(velocity);
-  pointData.DataArray().push_back(forces);
-  pointData.DataArray().push_back(type);
-
-  CellData cellData;  // we don't have cell data => leave it empty
-
-  // 3 coordinates
-  Points points;
-  DataArray_t pointCoordinates(type::Float32, "points", 3);
-  points.DataArray().push_back(pointCoordinates);
-
-  Cells cells;  // we don't have cells, => leave it empty
-  // for some reasons, we have to add a dummy entry for paraview
-  DataArray_t cells_data(type::Float32, "types", 0);
-  cells.DataArray().push_back(cells_data);
-
-  PieceUnstructuredGrid_t piece(pointData, cellData, points, cells, numParticles, 0);
-  UnstructuredGrid_t unstructuredGrid(piece);
-  vtkFile->UnstructuredGrid(unstructuredGrid);
+void VTKWriter::initializeOutput() {
+  for (auto *buffer : {&masses, &sigmas, &velocities, &forces, &points}) buffer->clear();
+  types.clear();
 }
 
 void VTKWriter::writeFile(const std::string &filename, int iteration) {
@@ -63,45 +40,74 @@ void VTKWriter::writeFile(const std::string &filename, int iteration) {
   strstr << filename << "_" << std::setfill('0') << std::setw(4) << iteration << ".vtu";
   auto finalFileName = strstr.str();
   spdlog::debug("Writing {}", finalFileName);
-  std::ofstream file(finalFileName);
-  VTKFile(file, *vtkFile);
-  delete vtkFile;
+  std::ofstream file(finalFileName, std::ios::binary);
+
+  const char *byteOrder = std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian";
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << byteOrder
+       << "\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << types.size() << "\" NumberOfCells=\"0\">\n";
+
+  // per point, we add type, position, velocity and force
+  size_t offset = 0;
+  file << "      <PointData>\n";
+  writeDataArrayHeader(file, "Float32", "mass", 1, masses.size() * sizeof(float), offset);
+  writeDataArrayHeader(file, "Float32", "sigma", 1, sigmas.size() * sizeof(float), offset);
+  writeDataArrayHeader(file, "Float32", "velocity", 3, velocities.size() * sizeof(float), offset);
+  writeDataArrayHeader(file, "Float32", "force", 3, forces.size() * sizeof(float), offset);
+  writeDataArrayHeader(file, "Int32", "type", 1, types.size() * sizeof(std::int32_t), offset);
+  file << "      </PointData>\n"
+       << "      <CellData/>\n"
+       << "      <Points>\n";
+  writeDataArrayHeader(file, "Float32", "points", 3, points.size() * sizeof(float), offset);
+
+  // we don't have cells, so the arrays describing them are empty
+  file << "      </Points>\n"
+       << "      <Cells>\n";
+  writeDataArrayHeader(file, "Int32", "connectivity", 1, 0, offset);
+  writeDataArrayHeader(file, "Int32", "offsets", 1, 0, offset);
+  writeDataArrayHeader(file, "UInt8", "types", 1, 0, offset);
+  file << "      </Cells>\n"
+       << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n"
+       << "   _";
+
+  writeAppendedData(file, masses);
+  writeAppendedData(file, sigmas);
+  writeAppendedData(file, velocities);
+  writeAppendedData(file, forces);
+  writeAppendedData(file, types);
+  writeAppendedData(file, points);
+  for (int i = 0; i < 3; ++i) writeAppendedData(file, std::vector<std::int32_t>{});
+
+  file << "\n  </AppendedData>\n"
+       << "</VTKFile>\n";
+}
+
+void VTKWriter::writeDataArrayHeader(std::ofstream &file, const char *type, const char *name, int components,
+                                     size_t bytes, size_t &offset) {
+  file << "        <DataArray type=\"" << type << "\" Name=\"" << name << "\" NumberOfComponents=\"" << components
+       << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+  offset += sizeof(HeaderType) + bytes;
+}
+
+template <typename T>
+void VTKWriter::writeAppendedData(std::ofstream &file, const std::vector<T> &values) {
+  HeaderType bytes = values.size() * sizeof(T);
+  file.write(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+  file.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(bytes));
 }
 
 void VTKWriter::plotParticle(Particle &p) {
-  if (vtkFile->UnstructuredGrid().present()) {
-    spdlog::trace("UnstructuredGrid is present");
-  } else {
-    spdlog::warn("ERROR: No UnstructuredGrid present");
+  masses.push_back(static_cast<float>(p.getM()));
+  sigmas.push_back(static_cast<float>(p.getSigma()));
+  types.push_back(p.getType());
+
+  for (int i = 0; i < 3; ++i) {
+    velocities.push_back(static_cast<float>(p.getV()[i]));
+    forces.push_back(static_cast<float>(p.getOldF()[i]));
+    points.push_back(static_cast<float>(p.getX()[i]));
   }
-
-  PointData::DataArray_sequence &pointDataSequence = vtkFile->UnstructuredGrid()->Piece().PointData().DataArray();
-  PointData::DataArray_iterator dataIterator = pointDataSequence.begin();
-
-  dataIterator->push_back(p.getM());
-  // cout << "Appended mass data in: " << dataIterator->Name();
-  dataIterator++;
-  dataIterator->push_back(p.getSigma());
-  // cout << "Appended sigma data in: " << dataIterator->Name();
-
-  dataIterator++;
-  dataIterator->push_back(p.getV()[0]);
-  dataIterator->push_back(p.getV()[1]);
-  dataIterator->push_back(p.getV()[2]);
-  // cout << "Appended velocity data in: " << dataIterator->Name();
-
-  dataIterator++;
-  dataIterator->push_back(p.getOldF()[0]);
-  dataIterator->push_back(p.getOldF()[1]);
-  dataIterator->push_back(p.getOldF()[2]);
-  // cout << "Appended force data in: " << dataIterator->Name();
-
-  dataIterator++;
-  dataIterator->push_back(p.getType());
-
-  Points::DataArray_sequence &pointsSequence = vtkFile->UnstructuredGrid()->Piece().Points().DataArray();
-  Points::DataArray_iterator pointsIterator = pointsSequence.begin();
-  pointsIterator->push_back(p.getX()[0]);
-  pointsIterator->push_back(p.getX()[1]);
-  pointsIterator->push_back(p.getX()[2]);
 }
@@ -7,16 +7,18 @@
 
 #pragma once
 
-#include <list>
+#include <cstdint>
+#include <fstream>
+#include <vector>
 
 #include "IWriter.h"
 #include "dataStructures/IContainer.h"
 #include "dataStructures/Particle.h"
-#include "outputWriter/vtk-unstructured.h"
 
 /**
  * This class implements the functionality to generate vtk output from
- * particles.
+ * particles. The data arrays are written as raw binary data into the appended
+ * section of the .vtu file, so no value is formatted as text.
  */
 class VTKWriter : public IWriter {
  public:
@@ -28,10 +30,9 @@ class VTKWriter : public IWriter {
 
  private:
   /**
-   * Setup internal data structures and prepare to plot data
-   * @param numParticles
+   * Clears the buffers, their capacity is kept for the next output
    */
-  void initializeOutput(int numParticles);
+  void initializeOutput();
 
   /**
    * writes the final output file.   *
@@ -48,5 +49,30 @@ class VTKWriter : public IWriter {
    */
   void plotParticle(Particle &p);
 
-  VTKFile_t *vtkFile;
+  /**
+   * Writes the xml element of a data array whose data lies in the appended section and advances the offset
+   * @param file The output file
+   * @param type The vtk type of the values, e.g. Float32
+   * @param name The name of the data array
+   * @param components The number of components per particle
+   * @param bytes The size of the data in bytes
+   * @param offset The offset of the data within the appended section, gets advanced past the data
+   */
+  static void writeDataArrayHeader(std::ofstream &file, const char *type, const char *name, int components,
+                                   size_t bytes, size_t &offset);
+
+  /**
+   * Writes the size of the data followed by the data itself into the appended section
+   * @param file The output file
+   * @param values The values of the data array
+   */
+  template <typename T>
+  static void writeAppendedData(std::ofstream &file, const std::vector<T> &values);
+
+  std::vector<float> masses;
+  std::vector<float> sigmas;
+  std::vector<float> velocities;
+  std::vector<float> forces;
+  std::vector<std::int32_t> types;
+  std::vector<float> points;
 };
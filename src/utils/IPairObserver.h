@@ -0,0 +1,30 @@
+#pragma once
+#include "dataStructures/Particle.h"
+
+/**
+ * Gets notified of the particle pairs visited by the force calculation, so that pair statistics can be accumulated
+ * without a separate pass over all pairs. Only the pairs the container visits are observed, which are at least all
+ * pairs within the cut off radius.
+ */
+class IPairObserver {
+ public:
+  virtual ~IPairObserver() = default;
+
+  /**
+   * Called before the pairs of a force calculation are observed
+   */
+  virtual void beginTraversal() = 0;
+
+  /**
+   * Called for each visited pair
+   * @param p1 The first particle of the pair
+   * @param p2 The second particle of the pair
+   * @note Parallel containers call this concurrently from their OpenMP threads
+   */
+  virtual void observe(const Particle &p1, const Particle &p2) = 0;
+
+  /**
+   * Called after all pairs of a force calculation were observed
+   */
+  virtual void endTraversal() = 0;
+};
@@ -9,7 +9,12 @@ enum class ContainerType {
   LINKED_CELLS = 1,
   LINKED_CELLS_LOCKS = 2,
   LINKED_CELLS_COLOURING_SINGLE = 3,
-  LINKED_CELLS_COLOURING_MULTIPLE = 4
+  LINKED_CELLS_COLOURING_MULTIPLE = 4,
+  LINKED_CELLS_SOA = 5,
+  LINKED_CELLS_VERLET = 6,
+  LINKED_CELLS_FORCE_BUFFER = 7,
+  LINKED_CELLS_FORCE_BUFFER_BLOCKED = 8,
+  BARNES_HUT = 9
 };
 
 /// Type of the used model
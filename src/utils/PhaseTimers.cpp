@@ -0,0 +1,150 @@
+#include "PhaseTimers.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+constexpr size_t phaseCount = static_cast<size_t>(Phase::Count);
+
+/// Padded to a cache line, so that the threads do not write to the same line
+struct alignas(64) Slot {
+  std::array<std::uint64_t, phaseCount> nanoseconds{};
+  std::array<std::uint64_t, phaseCount> calls{};
+};
+
+/// One slot per thread, allocated on enable so that adding a measurement never allocates
+std::vector<Slot> slots(1);
+
+const std::array<const char *, phaseCount> phaseNames{
+    "Integration",     "Force calculation", "Rebinning",  "Boundaries", "Periodic forces",
+    "Pair loop",       "Velocity update",   "Thermostat", "Output",     "Statistics",
+};
+
+bool isSubphase(Phase phase) {
+  return phase == Phase::Rebinning || phase == Phase::Boundaries || phase == Phase::PeriodicForces ||
+         phase == Phase::PairLoop || phase == Phase::VelocityUpdate;
+}
+
+/**
+ * @return The seconds of all phases that are not part of another phase
+ */
+double topLevelSeconds(const std::vector<PhaseTimers::PhaseSummary> &summaries) {
+  double seconds = 0.;
+  for (auto &summary : summaries) {
+    if (!summary.isSubphase) seconds += summary.seconds;
+  }
+  return seconds;
+}
+}  // namespace
+
+void PhaseTimers::detail::add(Phase phase, std::uint64_t nanoseconds) {
+#ifdef _OPENMP
+  size_t threadNum = omp_get_thread_num();
+#else
+  size_t threadNum = 0;
+#endif
+  // Threads beyond the number of threads at enable are not recorded
+  if (threadNum >= slots.size()) return;
+
+  auto index = static_cast<size_t>(phase);
+  slots[threadNum].nanoseconds[index] += nanoseconds;
+  ++slots[threadNum].calls[index];
+}
+
+void PhaseTimers::detail::trace(Phase phase, std::chrono::steady_clock::time_point start,
+                                std::chrono::steady_clock::time_point end) {
+  TraceRecorder::detail::record(phaseNames[static_cast<size_t>(phase)], -1, start, end);
+}
+
+void PhaseTimers::enable() {
+#ifdef _OPENMP
+  slots.assign(std::max(omp_get_max_threads(), omp_get_num_procs()), Slot{});
+#else
+  slots.assign(1, Slot{});
+#endif
+  detail::enabled = true;
+}
+
+void PhaseTimers::disable() { detail::enabled = false; }
+
+void PhaseTimers::reset() { std::fill(slots.begin(), slots.end(), Slot{}); }
+
+std::string PhaseTimers::getName(Phase phase) { return phaseNames.at(static_cast<size_t>(phase)); }
+
+std::vector<PhaseTimers::PhaseSummary> PhaseTimers::summarize() {
+  // Only the threads up to the last one that measured anything are reported
+  size_t threadCount = 1;
+  for (size_t t = 0; t < slots.size(); ++t) {
+    for (auto calls : slots[t].calls) {
+      if (calls != 0) threadCount = t + 1;
+    }
+  }
+
+  std::vector<PhaseSummary> summaries;
+  for (size_t index = 0; index < phaseCount; ++index) {
+    auto phase = static_cast<Phase>(index);
+    PhaseSummary summary{phase, getName(phase), isSubphase(phase), 0, std::vector<double>(threadCount, 0.), 0.};
+    for (size_t t = 0; t < threadCount; ++t) {
+      summary.calls += slots[t].calls[index];
+      summary.threadSeconds[t] = static_cast<double>(slots[t].nanoseconds[index]) * 1e-9;
+      summary.seconds = std::max(summary.seconds, summary.threadSeconds[t]);
+    }
+    summaries.push_back(std::move(summary));
+  }
+  return summaries;
+}
+
+void PhaseTimers::printTable(std::ostream &stream, double totalSeconds) {
+  auto summaries = summarize();
+  auto share = [totalSeconds](double seconds) { return totalSeconds > 0 ? 100. * seconds / totalSeconds : 0.; };
+
+  auto flags = stream.flags();
+  stream << "Phase breakdown (time of the slowest thread)\n"
+         << std::left << std::setw(24) << "Phase" << std::right << std::setw(12) << "Calls" << std::setw(14)
+         << "Time [s]" << std::setw(10) << "Share" << std::setw(10) << "Threads"
+         << "\n"
+         << std::fixed;
+  for (auto &summary : summaries) {
+    if (summary.calls == 0) continue;
+    auto threads = std::count_if(summary.threadSeconds.begin(), summary.threadSeconds.end(),
+                                 [](double seconds) { return seconds > 0; });
+    stream << std::left << std::setw(24) << ((summary.isSubphase ? "  " : "") + summary.name) << std::right
+           << std::setw(12) << summary.calls << std::setw(14) << std::setprecision(4) << summary.seconds
+           << std::setw(9) << std::setprecision(1) << share(summary.seconds) << "%" << std::setw(10) << threads
+           << "\n";
+  }
+  double untimed = std::max(0., totalSeconds - topLevelSeconds(summaries));
+  stream << std::left << std::setw(24) << "Not timed" << std::right << std::setw(12) << "" << std::setw(14)
+         << std::setprecision(4) << untimed << std::setw(9) << std::setprecision(1) << share(untimed) << "%"
+         << std::endl;
+  stream.flags(flags);
+}
+
+void PhaseTimers::writeJson(const std::string &path, double totalSeconds) {
+  std::ofstream file(path);
+  if (!file) throw std::runtime_error("Could not open " + path + " to write the phase timers.");
+
+  auto summaries = summarize();
+  file << std::setprecision(9) << "{\n"
+       << "  \"totalSeconds\": " << totalSeconds << ",\n"
+       << "  \"untimedSeconds\": " << std::max(0., totalSeconds - topLevelSeconds(summaries)) << ",\n"
+       << "  \"phases\": [\n";
+  for (size_t i = 0; i < summaries.size(); ++i) {
+    auto &summary = summaries[i];
+    file << "    {\"name\": \"" << summary.name << "\", \"parent\": "
+         << (summary.isSubphase ? "\"" + getName(Phase::ForceCalculation) + "\"" : "null")
+         << ", \"calls\": " << summary.calls << ", \"seconds\": " << summary.seconds << ", \"threadSeconds\": [";
+    for (size_t t = 0; t < summary.threadSeconds.size(); ++t) {
+      file << (t == 0 ? "" : ", ") << summary.threadSeconds[t];
+    }
+    file << "]}" << (i + 1 < summaries.size() ? "," : "") << "\n";
+  }
+  file << "  ]\n"
+       << "}\n";
+  if (!file) throw std::runtime_error("Could not write the phase timers to " + path + ".");
+}
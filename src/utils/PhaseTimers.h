@@ -0,0 +1,160 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "TraceRecorder.h"
+
+/// The timed phases of an iteration. The phases of the container are part of the force calculation.
+enum class Phase {
+  Integration,
+  ForceCalculation,
+  Rebinning,
+  Boundaries,
+  PeriodicForces,
+  PairLoop,
+  VelocityUpdate,
+  Thermostat,
+  Output,
+  Statistics,
+  Count
+};
+
+/**
+ * Low overhead timers for the phases of the simulation. Every thread adds its measurements to its own slot, so timers
+ * may also be used within parallel regions. While the timers are disabled, a ScopedPhaseTimer only checks a flag.
+ * The phases of sampled iterations are also recorded by the TraceRecorder, if it is enabled.
+ */
+namespace PhaseTimers {
+
+/// The accumulated measurements of a phase
+struct PhaseSummary {
+  Phase phase;
+  std::string name;
+
+  /// Whether the phase is part of the force calculation
+  bool isSubphase;
+
+  /// The number of measurements over all threads
+  std::uint64_t calls;
+
+  /// The accumulated seconds of each thread
+  std::vector<double> threadSeconds;
+
+  /// The maximum of threadSeconds, which is the wall time of the phase if it only runs on one thread per call
+  double seconds;
+};
+
+namespace detail {
+/// Read by every timer, so it is not hidden in the translation unit
+inline bool enabled{false};
+
+/**
+ * Adds a measurement to the slot of the calling thread
+ * @param phase The measured phase
+ * @param nanoseconds The duration of the measurement
+ */
+void add(Phase phase, std::uint64_t nanoseconds);
+
+/**
+ * Records a measurement as an event of the calling thread in the trace
+ * @param phase The measured phase
+ * @param start The begin of the measurement
+ * @param end The end of the measurement
+ */
+void trace(Phase phase, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+}  // namespace detail
+
+/**
+ * Enables the timers and resets all measurements
+ */
+void enable();
+
+/**
+ * Disables the timers, the measurements are kept
+ */
+void disable();
+
+/**
+ * @return Whether the timers are enabled
+ */
+inline bool isEnabled() { return detail::enabled; }
+
+/**
+ * Clears all measurements
+ */
+void reset();
+
+/**
+ * @param phase A phase
+ * @return The name of the phase
+ */
+std::string getName(Phase phase);
+
+/**
+ * Sums up the measurements of all threads
+ * @return The measurements of each phase, in the order of the Phase enum
+ */
+std::vector<PhaseSummary> summarize();
+
+/**
+ * Prints the phases as a table, including the share of each phase and the time outside of all phases
+ * @param stream The stream the table is printed to
+ * @param totalSeconds The duration of the whole simulation
+ */
+void printTable(std::ostream &stream, double totalSeconds);
+
+/**
+ * Writes the measurements as JSON, including the seconds of every thread
+ * @param path The path of the JSON file
+ * @param totalSeconds The duration of the whole simulation
+ * @throws std::runtime_error if the file can not be written
+ */
+void writeJson(const std::string &path, double totalSeconds);
+
+}  // namespace PhaseTimers
+
+/**
+ * Measures the time from its construction until it goes out of scope and adds it to a phase and to the trace
+ */
+class ScopedPhaseTimer {
+ private:
+  Phase phase;
+  bool active;
+  std::chrono::steady_clock::time_point start;
+
+ public:
+  /**
+   * Starts the measurement, if the timers are enabled or the current iteration is traced
+   * @param phase The measured phase
+   */
+  explicit ScopedPhaseTimer(Phase phase)
+      : phase{phase}, active{PhaseTimers::isEnabled() || TraceRecorder::isRecording()} {
+    if (active) start = std::chrono::steady_clock::now();
+  }
+
+  ScopedPhaseTimer(const ScopedPhaseTimer &) = delete;
+  ScopedPhaseTimer &operator=(const ScopedPhaseTimer &) = delete;
+
+  /**
+   * Ends the measurement before the timer goes out of scope and adds the measured time to the phase
+   */
+  void stop() {
+    if (!active) return;
+    active = false;
+    auto end = std::chrono::steady_clock::now();
+    if (PhaseTimers::isEnabled()) {
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+      PhaseTimers::detail::add(phase, static_cast<std::uint64_t>(elapsed.count()));
+    }
+    if (TraceRecorder::isRecording()) PhaseTimers::detail::trace(phase, start, end);
+  }
+
+  /**
+   * Adds the measured time to the phase, unless the measurement was stopped before
+   */
+  ~ScopedPhaseTimer() { stop(); }
+};
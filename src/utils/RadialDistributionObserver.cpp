@@ -0,0 +1,55 @@
+#include "RadialDistributionObserver.h"
+
+#include <cmath>
+
+#include "ThermodynamicStatistics.h"
+#include "utils/ArrayUtils.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+RadialDistributionObserver::RadialDistributionObserver(double deltaR, double rdfStart, double rdfEnd)
+    : deltaR{deltaR}, binStarts{ThermodynamicStatistics::getRDFBinStarts(deltaR, rdfStart, rdfEnd)} {
+  maxDistanceSquared = getMaxDistance() * getMaxDistance();
+}
+
+void RadialDistributionObserver::beginTraversal() {
+#ifdef _OPENMP
+  threadHistograms.resize(omp_get_max_threads());
+#else
+  threadHistograms.resize(1);
+#endif
+  for (auto &histogram : threadHistograms) histogram.assign(binStarts.size(), 0.);
+}
+
+void RadialDistributionObserver::observe(const Particle &p1, const Particle &p2) {
+  double distanceSquared = ArrayUtils::dotProduct(p1.getX() - p2.getX());
+  if (distanceSquared > maxDistanceSquared) return;
+
+  size_t bin = ThermodynamicStatistics::getRDFBin(binStarts, deltaR, std::sqrt(distanceSquared));
+  if (bin == binStarts.size()) return;
+
+#ifdef _OPENMP
+  ++threadHistograms[omp_get_thread_num()][bin];
+#else
+  ++threadHistograms[0][bin];
+#endif
+}
+
+void RadialDistributionObserver::endTraversal() {
+  pairCounts.assign(binStarts.size(), 0.);
+  for (auto &histogram : threadHistograms) {
+    for (size_t bin = 0; bin < histogram.size(); ++bin) pairCounts[bin] += histogram[bin];
+  }
+  hasResult = true;
+}
+
+double RadialDistributionObserver::getMaxDistance() const { return binStarts.empty() ? 0. : binStarts.back() + deltaR; }
+
+bool RadialDistributionObserver::takeDensities(std::vector<double> &densities) {
+  if (!hasResult) return false;
+
+  densities = ThermodynamicStatistics::getRDFDensities(binStarts, deltaR, pairCounts);
+  hasResult = false;
+  return true;
+}
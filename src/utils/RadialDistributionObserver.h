@@ -0,0 +1,58 @@
+#pragma once
+#include <vector>
+
+#include "IPairObserver.h"
+
+/**
+ * Accumulates the pair counts of the radial distribution function from the pairs visited by the force calculation.
+ * Each thread counts into its own histogram, which are summed up after the traversal.
+ * @note The result is only complete if the container visits all pairs within the largest bin, i.e. if the upper bound
+ * of the last bin does not exceed the cut off radius. Pairs through periodic boundaries are counted via the periodic
+ * images the container visits, like ThermodynamicStatistics::calculateRadialDistributionFunction does.
+ */
+class RadialDistributionObserver : public IPairObserver {
+ private:
+  /// The width of the bins
+  double deltaR;
+
+  /// The lower bounds of the bins
+  std::vector<double> binStarts;
+
+  /// Pairs further apart are not counted
+  double maxDistanceSquared;
+
+  /// One histogram per thread
+  std::vector<std::vector<double>> threadHistograms;
+
+  /// The summed up histogram of the last traversal
+  std::vector<double> pairCounts;
+
+  /// Whether pairCounts holds the result of a traversal that was not consumed yet
+  bool hasResult{false};
+
+ public:
+  /**
+   * @param deltaR The resolution of the rdf buckets
+   * @param rdfStart The start radius where the first bucket begins
+   * @param rdfEnd The radius where the last bucket begins
+   */
+  RadialDistributionObserver(double deltaR, double rdfStart, double rdfEnd);
+
+  void beginTraversal() override;
+
+  void observe(const Particle &p1, const Particle &p2) override;
+
+  void endTraversal() override;
+
+  /**
+   * @return The upper bound of the last bin, the container has to visit all pairs up to this distance
+   */
+  [[nodiscard]] double getMaxDistance() const;
+
+  /**
+   * Returns the densities of the last traversal and clears them
+   * @param densities Receives the densities
+   * @return Whether there was a traversal since the last call
+   */
+  bool takeDensities(std::vector<double> &densities);
+};
@@ -1,11 +1,18 @@
 #include "SimulationUtils.h"
 
+#include "dataStructures/BarnesHutContainer.h"
+#include "dataStructures/LinkedCellsContainerSoA.h"
+#include "dataStructures/LinkedCellsContainerVerlet.h"
 #include "dataStructures/VectorContainer.h"
 #include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringMultiple.h"
 #include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerForceBuffer.h"
 #include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerLocks.h"
 #include "model/SmoothedLennardJonesModel.h"
+#include "outputWriter/AsyncWriter.h"
 #include "outputWriter/StatisticsWriter.h"
+#include "utils/PhaseTimers.h"
+#include "utils/TraceRecorder.h"
 
 std::unique_ptr<LinkedCellsContainer> SimulationUtils::makeDefaultContainer() {
   // Fallback, when no linked cells container is specified.
@@ -26,12 +33,15 @@ std::unique_ptr<LinkedCellsContainer> SimulationUtils::makeDefaultContainer() {
   return defaultContainer;
 }
 
-std::unique_ptr<IContainer> SimulationUtils::makeContainer(ContainerType type, LinkedCellArg* spec) {
+std::unique_ptr<IContainer> SimulationUtils::makeContainer(ContainerType type, LinkedCellArg* spec, double cutOff,
+                                                          double theta) {
   if (type == ContainerType::VECTOR) return std::make_unique<VectorContainer>();
 
-  // Currently only vector and linked cells containers are supported. Assume the container is linked cells.
-  auto makeLinkedCells = [](auto type, double cellSize, auto left,
-                            auto right) -> std::unique_ptr<LinkedCellsContainer> {
+  if (type == ContainerType::BARNES_HUT) return std::make_unique<BarnesHutContainer>(theta);
+
+  // All other containers are linked cells containers.
+  auto makeLinkedCells = [cutOff, spec](auto type, double cellSize, auto left,
+                                       auto right) -> std::unique_ptr<LinkedCellsContainer> {
     if (type == ContainerType::LINKED_CELLS) return std::make_unique<LinkedCellsContainer>(cellSize, left, right);
 
     if (type == ContainerType::LINKED_CELLS_COLOURING_SINGLE)
@@ -43,6 +53,18 @@ std::unique_ptr<IContainer> SimulationUtils::makeContainer(ContainerType type, L
     if (type == ContainerType::LINKED_CELLS_LOCKS)
       return std::make_unique<LinkedCellsContainerLocks>(cellSize, left, right);
 
+    if (type == ContainerType::LINKED_CELLS_SOA)
+      return std::make_unique<LinkedCellsContainerSoA>(cellSize, left, right);
+
+    if (type == ContainerType::LINKED_CELLS_VERLET)
+      return std::make_unique<LinkedCellsContainerVerlet>(cellSize, left, right, cutOff, spec->getSkin());
+
+    if (type == ContainerType::LINKED_CELLS_FORCE_BUFFER)
+      return std::make_unique<LinkedCellsContainerForceBuffer>(cellSize, left, right, ForceBufferReduction::Full);
+
+    if (type == ContainerType::LINKED_CELLS_FORCE_BUFFER_BLOCKED)
+      return std::make_unique<LinkedCellsContainerForceBuffer>(cellSize, left, right, ForceBufferReduction::Blocked);
+
     throw std::runtime_error("Make function for ContainerType not implemented. Check SimulationUtils.cpp.");
   };
 
@@ -57,6 +79,7 @@ std::unique_ptr<IContainer> SimulationUtils::makeContainer(ContainerType type, L
       {CubeSide::FRONT, XMLParser::strToEnumBoundary(spec->getBoundFront())},
       {CubeSide::BACK, XMLParser::strToEnumBoundary(spec->getBoundBack())},
   });
+  container->setSortInterval(spec->getSortInterval());
 
   return container;
 }
@@ -112,7 +135,8 @@ std::unique_ptr<IModel> SimulationUtils::makeModel(ModelType modelType, double d
 }
 
 std::unique_ptr<IWriter> SimulationUtils::makeWriter(WriterType writerType) {
-  if (writerType == WriterType::VTKWriter) return std::make_unique<VTKWriter>();
+  // The files are written on a background thread, so the simulation does not wait for the output
+  if (writerType == WriterType::VTKWriter) return std::make_unique<AsyncWriter>(std::make_unique<VTKWriter>());
 
   return std::make_unique<NoWriter>();
 }
@@ -174,6 +198,35 @@ void ConfigurationUtils::printPerformanceMeasure(time_point startTime, time_poin
             << (static_cast<double>(simulation.getMoleculeUpdateCount()) / durationSec) << std::endl;
 }
 
+void ConfigurationUtils::printPhaseTimers(time_point startTime, time_point endTime, bool printTable,
+                                          const std::string& jsonPath) {
+  PhaseTimers::disable();
+  auto durationSec = std::chrono::duration<double>{endTime - startTime}.count();
+  if (printTable) PhaseTimers::printTable(std::cout, durationSec);
+  if (jsonPath.empty()) return;
+
+  try {
+    PhaseTimers::writeJson(jsonPath, durationSec);
+  } catch (const std::exception& exception) {
+    spdlog::error("Failed to write the phase timers. Error: {}", std::string(exception.what()));
+  }
+}
+
+void ConfigurationUtils::printLoadImbalance(IContainer& container) {
+  auto* statistics = container.getLoadImbalanceStatistics();
+  if (statistics != nullptr) statistics->print(std::cout);
+}
+
+void ConfigurationUtils::writeTrace(const std::string& path) {
+  TraceRecorder::disable();
+  try {
+    TraceRecorder::writeJson(path);
+    spdlog::info("Wrote {} trace events to {}.", TraceRecorder::getEventCount(), path);
+  } catch (const std::exception& exception) {
+    spdlog::error("Failed to write the trace. Error: {}", std::string(exception.what()));
+  }
+}
+
 void ConfigurationUtils::printHitrateMeasure(std::unique_ptr<IModel> model) {
   std::cout << "########################################################\n"
                "Results of hit-rate measurement\n"
@@ -21,9 +21,12 @@ namespace SimulationUtils {
  * Makes a container that can hold particles
  * @param type Type of the container (vector or linked cells)
  * @param spec The arguments for which the container should be build
+ * @param cutOff The cut off radius of the model, needed for the neighbor lists of the Verlet container
+ * @param theta The opening angle of the Barnes-Hut container
  * @return The container
  */
-std::unique_ptr<IContainer> makeContainer(ContainerType type, LinkedCellArg *spec);
+std::unique_ptr<IContainer> makeContainer(ContainerType type, LinkedCellArg *spec, double cutOff = 1e9,
+                                          double theta = 0.5);
 
 /**
  * Makes a default container. The container is a hard coded linked cells container.
@@ -65,7 +68,7 @@ void loadCheckpoint(IContainer &container, std::string checkpointPath);
 std::unique_ptr<IModel> makeModel(ModelType modelType, double deltaT, double cutOff = 1e9, double radius_l = 1e9);
 
 /**
- * Makes a writer that can output the contents of a container to a file
+ * Makes a writer that can output the contents of a container to a file. File writers are wrapped into an AsyncWriter.
  * @param writerType Type of the writer (e.g. vtk writer)
  * @return The writer
  */
@@ -107,6 +110,27 @@ void configureLogging(int logLevel, bool disableLogging);
  */
 void printPerformanceMeasure(time_point startTime, time_point endTime, Simulation &simulation);
 
+/**
+ * Prints the time spent in each phase of the simulation and writes it to a JSON file
+ * @param startTime Time when simulation started. (Excludes loading of files)
+ * @param endTime Time when simulation ended.
+ * @param printTable Whether the breakdown is printed as a table
+ * @param jsonPath The path of the JSON file, nothing is written if it is empty
+ */
+void printPhaseTimers(time_point startTime, time_point endTime, bool printTable, const std::string &jsonPath);
+
+/**
+ * Prints the load imbalance between the threads of the parallel force calculation, if the container measures it
+ * @param container The container of the simulation
+ */
+void printLoadImbalance(IContainer &container);
+
+/**
+ * Writes the events recorded during the sampled iterations as Chrome trace
+ * @param path The path of the trace file
+ */
+void writeTrace(const std::string &path);
+
 /**
  * Prints the hitrate of the model.
  * Hitrate is defined as (number_of_actual_calculations)/(number_of_total_calculations) where actual_calculations are
@@ -1,5 +1,8 @@
 #include "ThermodynamicStatistics.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "ArrayUtils.h"
 #include "dataStructures/IContainer.h"
 #include "dataStructures/LinkedCellsContainer.h"
@@ -21,18 +24,19 @@ double ThermodynamicStatistics::calculateVariance(IContainer *particleContainer)
 
   if (instanceof <VectorContainer>(particleContainer))
     for (Particle &p : particleContainer->getParticlesRef()) {
-      auto dist = L2Norm(p.getX() - p.getLastPosition());
+      auto dist = L2Norm(p.getX() - particleContainer->getHistory(p).lastPosition);
       dist *= dist;
       var += dist;
     }
   else {
     auto &lcc = dynamic_cast<LinkedCellsContainer &>(*particleContainer);
     for (Particle &p : particleContainer->getParticlesRef()) {
-      auto dist = L2Norm(ThermodynamicStatistics::getTruePosition(lcc, p.getX(), p.getPeriodicBoundariesCrossed()) -
-                         p.getLastPosition());
+      auto &history = lcc.getHistory(p);
+      auto dist = L2Norm(ThermodynamicStatistics::getTruePosition(lcc, p.getX(), history.periodicBoundariesCrossed) -
+                         history.lastPosition);
       dist *= dist;
       var += dist;
-      p.getPeriodicBoundariesCrossed() = {0, 0, 0};
+      history.periodicBoundariesCrossed = {0, 0, 0};
     }
   }
 
@@ -45,33 +49,201 @@ std::vector<double> ThermodynamicStatistics::calculateRadialDistributionFunction
                                                                                  IContainer *particleContainer,
                                                                                  double intervalStart,
                                                                                  double intervalEnd) {
-  std::vector<double> densities;
-  int size = static_cast<int>(particleContainer->size());
-  double i = intervalStart;
-  while (i <= intervalEnd) {
-    double numPairs = 0;
+  auto binStarts = getRDFBinStarts(deltaR, intervalStart, intervalEnd);
+  if (binStarts.empty()) return {};
 
-    for (int j = 0; j < size - 1; j++) {
-      Particle p1 = particleContainer->getParticlesRef().at(j);
+  // Periodic dimensions of a linked cells container have the length of the domain, the others 0
+  std::array<double, 3> periodicLengths{0., 0., 0.};
+  std::array<double, 3> leftLowerCorner{0., 0., 0.};
+  if (auto *linkedCells = dynamic_cast<LinkedCellsContainer *>(particleContainer)) {
+    leftLowerCorner = linkedCells->getLeftLowerCorner();
+    auto domain = linkedCells->getRightUpperCorner() - leftLowerCorner;
+    for (auto &boundary : linkedCells->getBoundaries()) {
+      // Two sides belong to each dimension, see CubeSide
+      auto dimension = static_cast<size_t>(boundary.getSide()) / 2;
+      if (boundary.getType() == BoundaryType::PERIODIC) periodicLengths[dimension] = domain[dimension];
+    }
+  }
 
-      for (int k = j + 1; k < size; k++) {
-        Particle p2 = particleContainer->getParticlesRef().at(k);
+  std::vector<std::array<double, 3>> positions;
+  positions.reserve(particleContainer->size());
+  for (Particle &p : particleContainer->getParticlesRef()) {
+    if (p.isDeleted()) continue;
 
-        double r = L2Norm(p1.getX() - p2.getX());
-        if (r > i && r <= i + deltaR) {
-          numPairs++;
-        }
-      }
+    // Positions in periodic dimensions are wrapped into [0, length) as countPairDistances expects
+    auto x = p.getX();
+    for (int d = 0; d < 3; ++d) {
+      if (periodicLengths[d] == 0) continue;
+      x[d] = std::fmod(x[d] - leftLowerCorner[d], periodicLengths[d]);
+      if (x[d] < 0) x[d] += periodicLengths[d];
     }
+    positions.push_back(x);
+  }
+
+  double maxDistance = binStarts.back() + deltaR;
+  auto histogram = countPairDistances(positions, binStarts, deltaR, maxDistance, periodicLengths);
+  return getRDFDensities(binStarts, deltaR, histogram);
+}
+
+std::vector<double> ThermodynamicStatistics::getRDFBinStarts(double deltaR, double intervalStart, double intervalEnd) {
+  // The bins (i, i + deltaR] start at intervalStart, intervalStart + deltaR, ... as long as i <= intervalEnd
+  std::vector<double> binStarts;
+  for (double i = intervalStart; i <= intervalEnd; i += deltaR) binStarts.push_back(i);
+  return binStarts;
+}
+
+size_t ThermodynamicStatistics::getRDFBin(std::vector<double> const &binStarts, double deltaR, double r) {
+  size_t binCount = binStarts.size();
+  if (binCount == 0 || r <= binStarts.front() || r > binStarts.back() + deltaR) return binCount;
 
+  // Estimate the bin, then correct it against the exact bin bounds, which carry the rounding of their summation
+  auto bin = static_cast<size_t>(std::max(0., std::ceil((r - binStarts.front()) / deltaR) - 1));
+  bin = std::min(bin, binCount - 1);
+  while (bin > 0 && r <= binStarts[bin]) --bin;
+  while (bin + 1 < binCount && r > binStarts[bin] + deltaR) ++bin;
+  return (r > binStarts[bin] && r <= binStarts[bin] + deltaR) ? bin : binCount;
+}
+
+std::vector<double> ThermodynamicStatistics::getRDFDensities(std::vector<double> const &binStarts, double deltaR,
+                                                             std::vector<double> const &pairCounts) {
+  std::vector<double> densities;
+  for (size_t bin = 0; bin < binStarts.size(); ++bin) {
+    double i = binStarts[bin];
     double cubeDiff = (i + deltaR);
     cubeDiff *= cubeDiff * cubeDiff;
     cubeDiff -= (i * i * i);
-    double density = (3.0 * numPairs) / ((4 * PI * cubeDiff));
+    double density = (3.0 * pairCounts[bin]) / ((4 * PI * cubeDiff));
     densities.emplace_back(density);
-
-    i += deltaR;
   }
 
   return densities;
-}
\ No newline at end of file
+}
+
+std::vector<double> ThermodynamicStatistics::countPairDistances(std::vector<std::array<double, 3>> &positions,
+                                                                std::vector<double> const &binStarts, double deltaR,
+                                                                double maxDistance,
+                                                                std::array<double, 3> const &periodicLengths) {
+  size_t binCount = binStarts.size();
+  if (positions.size() < 2) return std::vector<double>(binCount, 0.);
+
+  // Sort the positions into a grid whose cells are at least maxDistance wide, so that all pairs within maxDistance
+  // lie in the same or in adjacent cells. The cells are widened for sparse systems to limit the number of cells.
+  std::array<double, 3> lower = positions[0];
+  std::array<double, 3> upper = positions[0];
+  for (auto &x : positions) {
+    for (int d = 0; d < 3; ++d) {
+      lower[d] = std::min(lower[d], x[d]);
+      upper[d] = std::max(upper[d], x[d]);
+    }
+  }
+
+  double maxCellsPerDimension = std::ceil(std::cbrt(static_cast<double>(positions.size()))) + 1;
+  std::array<size_t, 3> dimensions{};
+  std::array<double, 3> cellSize{};
+  for (int d = 0; d < 3; ++d) {
+    if (periodicLengths[d] > 0) {
+      // The grid covers the periodic length exactly, so that the cells wrap around. With less than 3 cells the
+      // neighbors on both sides would be the same cell, so a single cell is used instead.
+      lower[d] = 0.;
+      double length = periodicLengths[d];
+      dimensions[d] = static_cast<size_t>(length / std::max(maxDistance, length / maxCellsPerDimension));
+      if (dimensions[d] < 3) dimensions[d] = 1;
+      cellSize[d] = length / static_cast<double>(dimensions[d]);
+      continue;
+    }
+    cellSize[d] = std::max(maxDistance, (upper[d] - lower[d]) / maxCellsPerDimension);
+    dimensions[d] = static_cast<size_t>((upper[d] - lower[d]) / cellSize[d]) + 1;
+  }
+
+  auto cellIndexOf = [&](std::array<double, 3> const &x) {
+    std::array<size_t, 3> coord{};
+    for (int d = 0; d < 3; ++d)
+      coord[d] = std::min(static_cast<size_t>((x[d] - lower[d]) / cellSize[d]), dimensions[d] - 1);
+    return coord[0] + dimensions[0] * (coord[1] + dimensions[1] * coord[2]);
+  };
+
+  // Counting sort of the positions by cell
+  size_t cellCount = dimensions[0] * dimensions[1] * dimensions[2];
+  std::vector<size_t> cellStarts(cellCount + 1, 0);
+  std::vector<size_t> cellIndices(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    cellIndices[i] = cellIndexOf(positions[i]);
+    ++cellStarts[cellIndices[i] + 1];
+  }
+  for (size_t cell = 0; cell < cellCount; ++cell) cellStarts[cell + 1] += cellStarts[cell];
+
+  std::vector<std::array<double, 3>> sorted(positions.size());
+  std::vector<size_t> insertPositions(cellStarts.begin(), cellStarts.end() - 1);
+  for (size_t i = 0; i < positions.size(); ++i) sorted[insertPositions[cellIndices[i]]++] = positions[i];
+
+  double minDistanceSquared = binStarts.front() > 0 ? binStarts.front() * binStarts.front() : -1.;
+  double maxDistanceSquared = maxDistance * maxDistance;
+  auto addPair = [&](std::vector<double> &histogram, std::array<double, 3> const &a, std::array<double, 3> const &b) {
+    // The distance to the nearest periodic image
+    auto distance = a - b;
+    for (int d = 0; d < 3; ++d) {
+      if (periodicLengths[d] > 0) distance[d] -= periodicLengths[d] * std::round(distance[d] / periodicLengths[d]);
+    }
+    double distanceSquared = ArrayUtils::dotProduct(distance);
+    if (distanceSquared > maxDistanceSquared || distanceSquared <= minDistanceSquared) return;
+
+    size_t bin = getRDFBin(binStarts, deltaR, std::sqrt(distanceSquared));
+    if (bin < binCount) ++histogram[bin];
+  };
+
+  std::vector<double> histogram(binCount, 0.);
+
+#ifdef _OPENMP
+#pragma omp parallel default(none) \
+    shared(histogram, sorted, cellStarts, dimensions, cellCount, binCount, addPair, periodicLengths)
+#endif
+  {
+    // Each thread counts into its own histogram, which are summed up at the end
+    std::vector<double> localHistogram(binCount, 0.);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+      std::array<size_t, 3> coord{cell % dimensions[0], (cell / dimensions[0]) % dimensions[1],
+                                  cell / (dimensions[0] * dimensions[1])};
+
+      for (size_t a = cellStarts[cell]; a < cellStarts[cell + 1]; ++a) {
+        for (size_t b = a + 1; b < cellStarts[cell + 1]; ++b) addPair(localHistogram, sorted[a], sorted[b]);
+      }
+
+      // Only the neighbors after the cell in memory order, so that each pair of cells is visited once
+      for (int dz = 0; dz <= 1; ++dz) {
+        for (int dy = (dz == 0 ? 0 : -1); dy <= 1; ++dy) {
+          for (int dx = (dz == 0 && dy == 0 ? 1 : -1); dx <= 1; ++dx) {
+            // Periodic dimensions wrap around, unless they consist of a single cell
+            std::array<int, 3> offset{dx, dy, dz};
+            std::array<size_t, 3> neighborCoord{};
+            bool inside = true;
+            for (int d = 0; d < 3; ++d) {
+              auto size = static_cast<long>(dimensions[d]);
+              long n = static_cast<long>(coord[d]) + offset[d];
+              if (periodicLengths[d] > 0 && size > 1) n = (n + size) % size;
+              inside = inside && n >= 0 && n < size;
+              neighborCoord[d] = static_cast<size_t>(n);
+            }
+            if (!inside) continue;
+
+            size_t neighbor = neighborCoord[0] + dimensions[0] * (neighborCoord[1] + dimensions[1] * neighborCoord[2]);
+            for (size_t a = cellStarts[cell]; a < cellStarts[cell + 1]; ++a) {
+              for (size_t b = cellStarts[neighbor]; b < cellStarts[neighbor + 1]; ++b)
+                addPair(localHistogram, sorted[a], sorted[b]);
+            }
+          }
+        }
+      }
+    }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+    for (size_t bin = 0; bin < binCount; ++bin) histogram[bin] += localHistogram[bin];
+  }
+
+  return histogram;
+}
@@ -16,6 +16,23 @@ class ThermodynamicStatistics {
   static std::array<double, 3> getTruePosition(LinkedCellsContainer &particleContainer,
                                                std::array<double, 3> oldPosition, std::array<int, 3> boundariesCrossed);
 
+  /**
+   * Counts the pairs of positions per distance bin. The positions are sorted into a grid with cells at least
+   * maxDistance wide, so only pairs in the same or adjacent cells are considered. The cells are processed in parallel
+   * with one histogram per thread. In periodic dimensions the distance to the nearest periodic image is used, like the
+   * force calculation does within the cut off radius, which requires maxDistance to be at most half the length.
+   * @param positions The positions of the particles, within [0, length) in periodic dimensions
+   * @param binStarts The lower bounds of the bins, in ascending order. A pair is counted in the bin i if its distance
+   * lies in (binStarts[i], binStarts[i] + deltaR].
+   * @param deltaR The width of the bins
+   * @param maxDistance The upper bound of the last bin
+   * @param periodicLengths The length of each periodic dimension, 0 for dimensions that are not periodic
+   * @return The number of pairs per bin
+   */
+  static std::vector<double> countPairDistances(std::vector<std::array<double, 3>> &positions,
+                                                std::vector<double> const &binStarts, double deltaR,
+                                                double maxDistance, std::array<double, 3> const &periodicLengths);
+
   /**
    * Used to determine the class of an object (similar to instanceof in Java)
    * @tparam Base
@@ -36,7 +53,9 @@ class ThermodynamicStatistics {
    */
   double calculateVariance(IContainer *particleContainer);
   /**
-   * Computes the calculateRadialDistributionFunction for particles in a LinkedCellsContainer
+   * Computes the calculateRadialDistributionFunction for particles in a LinkedCellsContainer. All bins are filled in a
+   * single pass over the pairs within the largest bin, deleted particles are ignored. Pairs through periodic
+   * boundaries are counted with the distance to the nearest periodic image.
    * @param deltaR
    * @param particleContainer
    * @param intervalStart
@@ -45,4 +64,30 @@ class ThermodynamicStatistics {
    */
   static std::vector<double> calculateRadialDistributionFunction(double deltaR, IContainer *particleContainer,
                                                                  double intervalStart, double intervalEnd);
+
+  /**
+   * @param deltaR The width of the bins
+   * @param intervalStart The start of the first bin
+   * @param intervalEnd The largest start of a bin
+   * @return The lower bounds of the rdf bins, in ascending order
+   */
+  static std::vector<double> getRDFBinStarts(double deltaR, double intervalStart, double intervalEnd);
+
+  /**
+   * @param binStarts The lower bounds of the bins, see getRDFBinStarts
+   * @param deltaR The width of the bins
+   * @param r The distance of a pair
+   * @return The bin i with r in (binStarts[i], binStarts[i] + deltaR], or the number of bins if there is none
+   */
+  static size_t getRDFBin(std::vector<double> const &binStarts, double deltaR, double r);
+
+  /**
+   * Normalizes the pair counts of the bins by the volumes of their spherical shells
+   * @param binStarts The lower bounds of the bins, see getRDFBinStarts
+   * @param deltaR The width of the bins
+   * @param pairCounts The number of pairs per bin
+   * @return The local densities
+   */
+  static std::vector<double> getRDFDensities(std::vector<double> const &binStarts, double deltaR,
+                                             std::vector<double> const &pairCounts);
 };
\ No newline at end of file
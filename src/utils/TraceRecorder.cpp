@@ -0,0 +1,110 @@
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+struct Event {
+  const char *name;
+  int index;
+  std::uint64_t iteration;
+  TraceRecorder::clock::duration start;
+  TraceRecorder::clock::duration duration;
+};
+
+/// Padded to a cache line, so that the threads do not write to the same line when appending
+struct alignas(64) ThreadEvents {
+  std::vector<Event> events;
+};
+
+/// The events of each thread, allocated on enable
+std::vector<ThreadEvents> threadEvents(1);
+
+std::uint64_t interval{1};
+std::uint64_t currentIteration{0};
+bool enabled{false};
+
+/// All timestamps are relative to the time the recorder was enabled
+TraceRecorder::clock::time_point origin{};
+
+/**
+ * @return The duration in microseconds, the time unit of the trace format
+ */
+double toMicroseconds(TraceRecorder::clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+}  // namespace
+
+void TraceRecorder::detail::record(const char *name, int index, clock::time_point start, clock::time_point end) {
+#ifdef _OPENMP
+  size_t threadNum = omp_get_thread_num();
+#else
+  size_t threadNum = 0;
+#endif
+  // Threads beyond the number of threads at enable are not recorded
+  if (threadNum >= threadEvents.size()) return;
+
+  threadEvents[threadNum].events.push_back({name, index, currentIteration, start - origin, end - start});
+}
+
+void TraceRecorder::enable(std::uint64_t samplingInterval) {
+  if (samplingInterval == 0) throw std::invalid_argument("The sampling interval of the trace must be at least 1.");
+
+#ifdef _OPENMP
+  threadEvents.assign(std::max(omp_get_max_threads(), omp_get_num_procs()), ThreadEvents{});
+#else
+  threadEvents.assign(1, ThreadEvents{});
+#endif
+  interval = samplingInterval;
+  origin = clock::now();
+  enabled = true;
+}
+
+void TraceRecorder::disable() {
+  enabled = false;
+  detail::recording = false;
+}
+
+void TraceRecorder::beginIteration(std::uint64_t iteration) {
+  currentIteration = iteration;
+  detail::recording = enabled && iteration % interval == 0;
+}
+
+size_t TraceRecorder::getEventCount() {
+  size_t count = 0;
+  for (auto &thread : threadEvents) count += thread.events.size();
+  return count;
+}
+
+void TraceRecorder::writeJson(const std::string &path) {
+  std::ofstream file(path);
+  if (!file) throw std::runtime_error("Could not open " + path + " to write the trace.");
+
+  file << std::fixed << std::setprecision(3) << "{\n"
+       << "  \"displayTimeUnit\": \"ms\",\n"
+       << "  \"traceEvents\": [\n";
+  bool first = true;
+  for (size_t t = 0; t < threadEvents.size(); ++t) {
+    if (threadEvents[t].events.empty()) continue;
+
+    file << (first ? "" : ",\n") << "    {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << t
+         << ", \"args\": {\"name\": \"Thread " << t << "\"}}";
+    first = false;
+    for (auto &event : threadEvents[t].events) {
+      file << ",\n    {\"name\": \"" << event.name;
+      if (event.index >= 0) file << " " << event.index;
+      file << "\", \"cat\": \"phase\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << t
+           << ", \"ts\": " << toMicroseconds(event.start) << ", \"dur\": " << toMicroseconds(event.duration)
+           << ", \"args\": {\"iteration\": " << event.iteration << "}}";
+    }
+  }
+  file << "\n  ]\n"
+       << "}\n";
+  if (!file) throw std::runtime_error("Could not write the trace to " + path + ".");
+}
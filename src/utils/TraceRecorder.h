@@ -0,0 +1,95 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * Records the phases of sampled iterations as events of the thread that executed them and writes them in the Chrome
+ * Trace Event format, which can be opened with chrome://tracing or https://ui.perfetto.dev. Only every n-th iteration
+ * is recorded to bound the size of the trace. The phases are recorded by the ScopedPhaseTimers, the threads of
+ * parallel regions record their own events with a ScopedTraceEvent.
+ */
+namespace TraceRecorder {
+
+using clock = std::chrono::steady_clock;
+
+namespace detail {
+/// Whether the current iteration is recorded, read by every timer and only changed between iterations
+inline bool recording{false};
+
+/**
+ * Adds an event to the events of the calling thread
+ * @param name The name of the event, has to outlive the recorder
+ * @param index An index appended to the name, e.g. the colour, or -1
+ * @param start The begin of the event
+ * @param end The end of the event
+ */
+void record(const char *name, int index, clock::time_point start, clock::time_point end);
+}  // namespace detail
+
+/**
+ * Enables the recorder and removes all recorded events
+ * @param samplingInterval Every samplingInterval-th iteration is recorded
+ * @throws std::invalid_argument if the sampling interval is zero
+ */
+void enable(std::uint64_t samplingInterval);
+
+/**
+ * Disables the recorder, the recorded events are kept
+ */
+void disable();
+
+/**
+ * Starts an iteration, which is recorded if it is a sampled one. Must not be called within a parallel region.
+ * @param iteration The number of the iteration
+ */
+void beginIteration(std::uint64_t iteration);
+
+/**
+ * @return Whether the current iteration is recorded
+ */
+inline bool isRecording() { return detail::recording; }
+
+/**
+ * @return The number of recorded events of all threads
+ */
+size_t getEventCount();
+
+/**
+ * Writes the recorded events as Chrome Trace Event JSON
+ * @param path The path of the JSON file
+ * @throws std::runtime_error if the file can not be written
+ */
+void writeJson(const std::string &path);
+
+}  // namespace TraceRecorder
+
+/**
+ * Records the time from its construction until it goes out of scope as an event of the calling thread, if the current
+ * iteration is recorded
+ */
+class ScopedTraceEvent {
+ private:
+  const char *name;
+  int index;
+  bool active;
+  TraceRecorder::clock::time_point start;
+
+ public:
+  /**
+   * Starts the event, if the current iteration is recorded
+   * @param name The name of the event, has to outlive the recorder
+   * @param index An index appended to the name, e.g. the colour, or -1
+   */
+  explicit ScopedTraceEvent(const char *name, int index = -1)
+      : name{name}, index{index}, active{TraceRecorder::isRecording()} {
+    if (active) start = TraceRecorder::clock::now();
+  }
+
+  ScopedTraceEvent(const ScopedTraceEvent &) = delete;
+  ScopedTraceEvent &operator=(const ScopedTraceEvent &) = delete;
+
+  ~ScopedTraceEvent() {
+    if (active) TraceRecorder::detail::record(name, index, start, TraceRecorder::clock::now());
+  }
+};
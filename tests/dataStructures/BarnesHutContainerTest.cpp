@@ -0,0 +1,140 @@
+#include <random>
+
+#include "dataStructures/BarnesHutContainer.h"
+#include "gtest/gtest.h"
+#include "model/LennardJonesModel.h"
+#include "model/NewtonsLawModel.h"
+
+namespace {
+/**
+ * Fills both containers with the same randomly placed particles of random masses
+ * @param count The number of particles
+ */
+void setupContainers(VectorContainer &expected, VectorContainer &actual, size_t count) {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> position{-50., 50.};
+  std::uniform_real_distribution<double> mass{0.5, 2.};
+  for (size_t i = 0; i < count; ++i) {
+    std::array<double, 3> x{position(generator), position(generator), position(generator)};
+    double m = mass(generator);
+    expected.emplace_back(x, {}, m, 0);
+    actual.emplace_back(x, {}, m, 0);
+  }
+}
+
+/**
+ * Applies one force calculation via applyForceModel, which is the path the simulation takes
+ * @param container The container the model gets applied to
+ * @param model The model used for the force calculation
+ */
+void applyForceModel(IContainer &container, IModel &model) {
+  using P = Particle &;
+  std::function<void(P, P)> addForces{
+      [&model](P p1, P p2) { model.addForces(std::forward<P>(p1), std::forward<P>(p2)); }};
+  container.applyForceModel(model, addForces);
+}
+
+/**
+ * Calculates the root mean square of the force errors relative to the root mean square of the expected forces
+ */
+double relativeForceError(VectorContainer &expected, VectorContainer &actual) {
+  double errorSum = 0., forceSum = 0.;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    auto &expectedForce = expected.getParticlesRef()[i].getF();
+    auto &actualForce = actual.getParticlesRef()[i].getF();
+    for (int d = 0; d < 3; ++d) {
+      errorSum += (expectedForce[d] - actualForce[d]) * (expectedForce[d] - actualForce[d]);
+      forceSum += expectedForce[d] * expectedForce[d];
+    }
+  }
+  return std::sqrt(errorSum / forceSum);
+}
+}  // namespace
+
+/**
+ * Make sure the tree with theta = 0 opens every node and matches the direct sum up to the summation order. The
+ * particle count is large enough for the upper levels of the tree to be built in parallel.
+ */
+TEST(BarnesHutContainer, ThetaZeroEqualsDirectSum) {
+  VectorContainer directSum{};
+  BarnesHutContainer barnesHut{0.};
+  setupContainers(directSum, barnesHut, 5000);
+
+  NewtonsLawModel model{};
+  applyForceModel(directSum, model);
+  applyForceModel(barnesHut, model);
+
+  EXPECT_GT(barnesHut.getNodeCount(), 5000 / 8);
+  for (size_t i = 0; i < directSum.size(); ++i) {
+    for (int d = 0; d < 3; ++d) {
+      double expectedForce = directSum.getParticlesRef()[i].getF()[d];
+      EXPECT_NEAR(expectedForce, barnesHut.getParticlesRef()[i].getF()[d], 1e-12 + 1e-9 * std::abs(expectedForce))
+          << "Particle " << i;
+    }
+  }
+}
+
+/**
+ * Make sure the approximation error shrinks with the opening angle and stays in the expected order of theta²
+ */
+TEST(BarnesHutContainer, ErrorDecreasesWithTheta) {
+  NewtonsLawModel model{};
+  double previousError = 0.;
+  for (double theta : {0.3, 0.5, 0.8}) {
+    VectorContainer directSum{};
+    BarnesHutContainer barnesHut{theta};
+    setupContainers(directSum, barnesHut, 2000);
+
+    applyForceModel(directSum, model);
+    applyForceModel(barnesHut, model);
+
+    double error = relativeForceError(directSum, barnesHut);
+    EXPECT_GT(error, previousError) << "theta = " << theta;
+    EXPECT_LT(error, 0.03 * theta * theta) << "theta = " << theta;
+    previousError = error;
+  }
+}
+
+/**
+ * Make sure the tree is rebuilt for the current positions on every force calculation
+ */
+TEST(BarnesHutContainer, RebuildsAfterMovement) {
+  VectorContainer directSum{};
+  BarnesHutContainer barnesHut{0.};
+  setupContainers(directSum, barnesHut, 100);
+
+  NewtonsLawModel model{};
+  applyForceModel(barnesHut, model);
+
+  for (size_t i = 0; i < directSum.size(); ++i) {
+    auto &p = barnesHut.getParticlesRef()[i];
+    std::array<double, 3> x{p.getX()[1], -p.getX()[0], 2 * p.getX()[2]};
+    p.setX(x);
+    p.setF({0., 0., 0.});
+    directSum.getParticlesRef()[i].setX(x);
+  }
+  applyForceModel(directSum, model);
+  applyForceModel(barnesHut, model);
+
+  EXPECT_LT(relativeForceError(directSum, barnesHut), 1e-12);
+}
+
+/**
+ * Make sure other models use the pairwise force calculation
+ */
+TEST(BarnesHutContainer, OtherModelsUseAllPairs) {
+  VectorContainer directSum{};
+  BarnesHutContainer barnesHut{0.8};
+  directSum.emplace_back({0., 0., 0.}, {}, 1., 0);
+  directSum.emplace_back({1.1, 0., 0.}, {}, 1., 0);
+  directSum.emplace_back({0., 1.2, 0.}, {}, 1., 0);
+  for (auto &p : directSum.getParticlesRef()) barnesHut.emplace_back(p.getX(), {}, p.getM(), p.getType());
+
+  LennardJonesModel model{3.};
+  applyForceModel(directSum, model);
+  applyForceModel(barnesHut, model);
+
+  for (size_t i = 0; i < directSum.size(); ++i) {
+    EXPECT_EQ(directSum.getParticlesRef()[i].getF(), barnesHut.getParticlesRef()[i].getF());
+  }
+}
@@ -313,6 +313,35 @@ TEST_F(LinkedCellsReflectiveBoundary, IgnoreOutOfRange) {
   }
 }
 
+/**
+ * The reflection uses the Lennard-Jones parameters of the type of the reflected particle
+ */
+TEST(LinkedCellsReflectiveBoundaryType, UsesParticleType) {
+  int const type = 31;
+  double const sigma = 1.5;
+  double const epsilon = 2.0;
+  Particle::registerParticleType(type, epsilon, sigma);
+
+  v3d leftCorner{0., 0., 0.};
+  v3d rightCorner{10., 10., 10.};
+  LinkedCellsContainer container{5.0, leftCorner, rightCorner};
+  container.setBoundaries({{CubeSide::LEFT, BoundaryType::REFLECT}});
+
+  double const distance = 1.;
+  container.emplace_back({distance, 5., 5.}, {0., 0., 0.}, 1., type);
+  container.applyBoundaries();
+
+  // The particle and its mirror image are 2 * distance apart
+  double const sixthPower = std::pow(sigma / (2 * distance), 6);
+  double const expected = 24 * epsilon / (2 * distance) * (2 * sixthPower * sixthPower - sixthPower);
+  std::function checkForce{[expected](Particle& p) {
+    EXPECT_DOUBLE_EQ(p.getF()[0], expected);
+    EXPECT_EQ(p.getF()[1], 0.);
+    EXPECT_EQ(p.getF()[2], 0.);
+  }};
+  container.forEach(checkForce);
+}
+
 /**
  * Holds values for periodic boundary tests
  */
@@ -0,0 +1,125 @@
+#include "dataStructures/LinkedCellsContainerSoA.h"
+#include "gtest/gtest.h"
+#include "model/NewtonsLawModel.h"
+#include "model/SmoothedLennardJonesModel.h"
+#include "utils/TestUtils.h"
+
+namespace {
+/**
+ * Applies one force calculation via applyForceModel, which is the path the simulation takes
+ * @param container The container the model gets applied to
+ * @param model The model used for the force calculation
+ */
+void applyForceModel(LinkedCellsContainer &container, IModel &model) {
+  using P = Particle &;
+  std::function<void(P, P)> addForces{
+      [&model](P p1, P p2) { model.addForces(std::forward<P>(p1), std::forward<P>(p2)); }};
+  container.applyForceModel(model, addForces);
+}
+}  // namespace
+
+/**
+ * Make sure the structure of arrays force calculation matches the one of the normal linked cells container, including
+ * periodic and reflecting boundaries.
+ */
+TEST(LinkedCellsContainerSoA, compareResultsToLinkedCells) {
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+  LinkedCellsContainer linkedCellsContainer{1.5, left, right};
+  LinkedCellsContainerSoA soaContainer{1.5, left, right};
+
+  TestUtils::setupLinkedCellsContainer(linkedCellsContainer);
+  TestUtils::setupLinkedCellsContainer(soaContainer);
+
+  LennardJonesModel model{1.5};
+  TestUtils::applyForceCalc(linkedCellsContainer);
+  applyForceModel(soaContainer, model);
+
+  TestUtils::expectEqualForces(linkedCellsContainer, soaContainer);
+}
+
+/**
+ * Make sure mixed particle types and the other models are handled like in the particle based force calculation.
+ */
+TEST(LinkedCellsContainerSoA, compareModelsWithMixedTypes) {
+  Particle::registerParticleType(7, 2.0, 1.1);
+  Particle::registerParticleType(8, 1.0, 0.9);
+
+  v3d left{0., 0., 0.};
+  v3d right{6., 6., 6.};
+
+  std::vector<std::unique_ptr<IModel>> models;
+  models.push_back(std::make_unique<LennardJonesModel>(2.0));
+  models.push_back(std::make_unique<SmoothedLennardJonesModel>(2.0, 1.5));
+  models.push_back(std::make_unique<NewtonsLawModel>());
+
+  for (auto &model : models) {
+    LinkedCellsContainer linkedCellsContainer{2.0, left, right};
+    LinkedCellsContainerSoA soaContainer{2.0, left, right};
+
+    for (int i = 0; i < 60; ++i) {
+      v3d position{0.3 + (i % 5) * 1.1, 0.5 + ((i / 5) % 4) * 1.3, 0.2 + (i / 20) * 1.7};
+      linkedCellsContainer.emplace_back(position, {}, 1. + i % 3, 7 + i % 2);
+      soaContainer.emplace_back(position, {}, 1. + i % 3, 7 + i % 2);
+    }
+
+    using P = Particle &;
+    std::function<void(P, P)> addForces{[&model](P p1, P p2) { model->addForces(p1, p2); }};
+    linkedCellsContainer.forEachPair(addForces);
+    applyForceModel(soaContainer, *model);
+
+    TestUtils::expectEqualForces(linkedCellsContainer, soaContainer);
+  }
+}
+
+/**
+ * Every Lennard-Jones kernel the CPU supports must match the normal linked cells container.
+ */
+TEST(LinkedCellsContainerSoA, compareKernelsToLinkedCells) {
+  using LennardJonesKernels::KernelType;
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+
+  for (auto type : {KernelType::Scalar, KernelType::AVX2, KernelType::AVX512}) {
+    if (!LennardJonesKernels::isSupported(type)) continue;
+
+    LinkedCellsContainer linkedCellsContainer{1.5, left, right};
+    LinkedCellsContainerSoA soaContainer{1.5, left, right};
+    soaContainer.setLennardJonesKernel(type);
+
+    TestUtils::setupLinkedCellsContainer(linkedCellsContainer);
+    TestUtils::setupLinkedCellsContainer(soaContainer);
+
+    LennardJonesModel model{1.5};
+    TestUtils::applyForceCalc(linkedCellsContainer);
+    applyForceModel(soaContainer, model);
+
+    TestUtils::expectEqualForces(linkedCellsContainer, soaContainer);
+  }
+}
+
+/**
+ * The structure of arrays must mirror the particle vector.
+ */
+TEST(LinkedCellsContainerSoA, loadMirrorsParticles) {
+  std::vector<Particle> particles;
+  particles.emplace_back(v3d{1., 2., 3.}, v3d{4., 5., 6.}, 7., 0);
+  particles.emplace_back(v3d{-1., -2., -3.}, v3d{0., 0., 1.}, 2., 1);
+
+  std::vector<size_t> order{0, 1};
+
+  ParticleSoA soa;
+  soa.load(particles, order);
+
+  ASSERT_EQ(soa.size(), 2);
+  EXPECT_EQ(soa.x[1], -1.);
+  EXPECT_EQ(soa.y[0], 2.);
+  EXPECT_EQ(soa.m[0], 7.);
+  EXPECT_EQ(soa.typeIndex[1], particles[1].getTypeIndex());
+  EXPECT_EQ(soa.fx[0], 0.);
+
+  soa.fy[1] = 2.5;
+  soa.storeForces(particles, order);
+  EXPECT_EQ(particles[1].getF()[1], 2.5);
+  EXPECT_EQ(particles[0].getF()[1], 0.);
+}
@@ -1,6 +1,10 @@
+#include <map>
+
 #include "dataStructures/LinkedCellsContainer.h"
 #include "gtest/gtest.h"
+#include "model/LennardJonesModel.h"
 #include "utils/ArrayUtils.h"
+#include "utils/TestUtils.h"
 
 using v3d = std::array<double, 3>;
 
@@ -237,4 +241,170 @@ TEST(LinkedCellsContainer, PairAdjacentParticlesAdvanced) {
   c.forEachPair(countCalls);
 
   EXPECT_EQ(counter, 1 + (4 * 2));
-}
\ No newline at end of file
+}
+/**
+ * Make sure sorting by cell keeps the particles of each cell contiguous and drops deleted particles
+ */
+TEST(LinkedCellsContainer, SortParticlesByCell) {
+  v3d leftCorner{0., 0., 0.};
+  v3d rightCorner{6., 6., 6.};
+  LinkedCellsContainer c{2.0, leftCorner, rightCorner};
+  c.setSortInterval(1);
+
+  c.emplace_back(v3d{5., 5., 5.}, v3d{0., 0., 0.}, 1., 1);
+  c.emplace_back(v3d{1., 1., 1.}, v3d{0., 0., 0.}, 1., 2);
+  c.emplace_back(v3d{5.5, 5., 5.}, v3d{0., 0., 0.}, 1., 3);
+  c.emplace_back(v3d{3., 1., 1.}, v3d{0., 0., 0.}, 1., 4);
+  c.emplace_back(v3d{1.5, 1., 1.}, v3d{0., 0., 0.}, 1., 5);
+  c.getParticlesRef()[3].deleteParticle();
+
+  c.recalculateStructure();
+
+  ASSERT_EQ(c.getParticlesRef().size(), 4);
+  size_t expectedIndex = 0;
+  for (auto &cell : c.getCellsVector()) {
+    for (auto index : cell.particles) EXPECT_EQ(index, expectedIndex++) << "Cell ranges must be contiguous";
+  }
+  EXPECT_EQ(expectedIndex, 4);
+
+  // The relative order of particles within a cell is preserved
+  std::vector<int> types;
+  for (auto &p : c.getParticlesRef()) types.push_back(p.getType());
+  EXPECT_EQ(types, (std::vector<int>{2, 5, 1, 3}));
+}
+
+/**
+ * Make sure sorting the particles does not change the result of the force calculation
+ */
+TEST(LinkedCellsContainer, SortedForcesMatchUnsorted) {
+  v3d leftCorner{0., 0., 0.};
+  v3d rightCorner{6., 6., 6.};
+  LinkedCellsContainer unsorted{1.5, leftCorner, rightCorner};
+  LinkedCellsContainer sorted{1.5, leftCorner, rightCorner};
+  sorted.setSortInterval(1);
+
+  for (int i = 0; i < 100; ++i) {
+    v3d position{(i * 37 % 59) / 10., (i * 11 % 53) / 9., (i * 7 % 31) / 5.5};
+    unsorted.emplace_back(position, v3d{0., 0., 0.}, 1., i);
+    sorted.emplace_back(position, v3d{0., 0., 0.}, 1., i);
+  }
+
+  // Accumulate a position dependent value onto the type of each pair, since the particle order changes
+  std::map<int, double> unsortedSums;
+  std::map<int, double> sortedSums;
+  std::function sumUnsorted = [&unsortedSums](Particle &p1, Particle &p2) {
+    double distance = ArrayUtils::L2Norm(p1.getX() - p2.getX());
+    unsortedSums[p1.getType()] += distance;
+    unsortedSums[p2.getType()] += distance;
+  };
+  std::function sumSorted = [&sortedSums](Particle &p1, Particle &p2) {
+    double distance = ArrayUtils::L2Norm(p1.getX() - p2.getX());
+    sortedSums[p1.getType()] += distance;
+    sortedSums[p2.getType()] += distance;
+  };
+  unsorted.forEachPair(sumUnsorted);
+  sorted.forEachPair(sumSorted);
+
+  ASSERT_EQ(unsortedSums.size(), sortedSums.size());
+  for (auto [type, sum] : unsortedSums) EXPECT_NEAR(sum, sortedSums[type], 1e-9);
+}
+
+/**
+ * Make sure the pair loop specialized for the model calculates the same forces as the one via std::function
+ */
+TEST(LinkedCellsContainer, ForEachPairWithModelMatchesForEachPair) {
+  v3d leftCorner{0., 0., 0.};
+  v3d rightCorner{7., 3., 2.5};
+  LinkedCellsContainer generic{1.5, leftCorner, rightCorner};
+  LinkedCellsContainer specialized{1.5, leftCorner, rightCorner};
+  TestUtils::setupLinkedCellsContainer(generic);
+  TestUtils::setupLinkedCellsContainer(specialized);
+
+  LennardJonesModel model{1.5};
+  TestUtils::applyForceCalc(generic);
+  specialized.forEachPairWithModel(model);
+
+  auto &genericParticles = generic.getParticlesRef();
+  auto &specializedParticles = specialized.getParticlesRef();
+  ASSERT_EQ(genericParticles.size(), specializedParticles.size());
+  for (size_t i = 0; i < genericParticles.size(); ++i) {
+    for (int j = 0; j < 3; ++j) EXPECT_DOUBLE_EQ(genericParticles[i].getF()[j], specializedParticles[i].getF()[j]);
+  }
+}
+
+/**
+ * Updating the velocities during the force calculation must give the same velocities as a separate pass afterwards,
+ * for the generic and the specialized pair loop
+ */
+TEST(LinkedCellsContainer, ForEachPairAndFinalizeMatchesSeparatePasses) {
+  v3d leftCorner{0., 0., 0.};
+  v3d rightCorner{7., 3., 2.5};
+  LinkedCellsContainer separate{1.5, leftCorner, rightCorner};
+  LinkedCellsContainer fused{1.5, leftCorner, rightCorner};
+  LinkedCellsContainer fusedSpecialized{1.5, leftCorner, rightCorner};
+  for (auto *container : {&separate, &fused, &fusedSpecialized}) TestUtils::setupLinkedCellsContainer(*container);
+
+  LennardJonesModel model{1.5};
+  model.setDeltaT(0.0005);
+  using P = Particle &;
+  std::function<void(P, P)> addForces{[&model](P p1, P p2) { model.addForces(p1, p2); }};
+  size_t updateCount{0};
+  std::function<void(P)> updateV{[&model, &updateCount](P p) {
+    model.updateV(p);
+    ++updateCount;
+  }};
+
+  separate.forEachPair(addForces);
+  separate.forEach(updateV);
+  size_t expectedUpdateCount = updateCount;
+
+  updateCount = 0;
+  fused.forEachPairAndFinalize(addForces, updateV);
+  EXPECT_EQ(updateCount, expectedUpdateCount);
+
+  updateCount = 0;
+  fusedSpecialized.forEachPairWithModel(model, updateV);
+  EXPECT_EQ(updateCount, expectedUpdateCount);
+
+  auto &expected = separate.getParticlesRef();
+  for (auto *container : {&fused, &fusedSpecialized}) {
+    auto &actual = container->getParticlesRef();
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      for (int j = 0; j < 3; ++j) EXPECT_DOUBLE_EQ(expected[i].getV()[j], actual[i].getV()[j]);
+    }
+  }
+}
+
+/**
+ * The ghost particles of the periodic boundaries only exist during the pair loop, afterwards each particle is linked in
+ * exactly one cell again. Particles deleted by an outflow boundary are removed from the cells.
+ */
+TEST(LinkedCellsContainer, GhostParticlesAreRemovedAfterForEachPair) {
+  LinkedCellsContainer container{1.5, {0., 0., 0.}, {7., 3., 2.5}};
+  TestUtils::setupLinkedCellsContainer(container);
+  size_t particleCount = container.getParticlesRef().size();
+
+  TestUtils::applyForceCalc(container);
+  ASSERT_EQ(container.getParticlesRef().size(), particleCount);
+
+  std::vector<size_t> linkCount(particleCount, 0);
+  for (auto &cell : container.getCellsVector()) {
+    for (auto index : cell.particles) {
+      ASSERT_LT(index, particleCount);
+      ++linkCount[index];
+    }
+  }
+  for (auto count : linkCount) EXPECT_EQ(count, 1);
+
+  LinkedCellsContainer outflowContainer{1., {0., 0., 0.}, {3., 3., 3.}};
+  outflowContainer.setBoundaries({{CubeSide::LEFT, BoundaryType::OUTFLOW}});
+  outflowContainer.emplace_back({1.5, 1.5, 1.5}, {}, 1., 1);
+  outflowContainer.emplace_back({-0.5, 1.5, 1.5}, {}, 1., 1);
+
+  TestUtils::applyForceCalc(outflowContainer);
+  EXPECT_TRUE(outflowContainer.getParticlesRef()[1].isDeleted());
+  for (auto &cell : outflowContainer.getCellsVector()) {
+    for (auto index : cell.particles) EXPECT_NE(index, 1);
+  }
+}
@@ -0,0 +1,123 @@
+#include "dataStructures/LinkedCellsContainerVerlet.h"
+#include "gtest/gtest.h"
+#include "utils/TestUtils.h"
+
+namespace {
+/**
+ * Resets the forces of all particles of the container
+ */
+void resetForces(LinkedCellsContainer &container) {
+  for (auto &p : container.getParticlesRef()) p.setF({0., 0., 0.});
+}
+}  // namespace
+
+/**
+ * Make sure the forces calculated via the neighbor lists match the ones of the linked cells container, including
+ * periodic and reflecting boundaries.
+ */
+TEST(LinkedCellsContainerVerlet, compareResultsToLinkedCells) {
+  v3d left{0., 0., 0.};
+  v3d right{8., 4., 4.};
+  LinkedCellsContainer linkedCellsContainer{2., left, right};
+  LinkedCellsContainerVerlet verletContainer{2., left, right, 1.5, 0.5};
+
+  TestUtils::setupLinkedCellsContainer(linkedCellsContainer);
+  TestUtils::setupLinkedCellsContainer(verletContainer);
+
+  TestUtils::applyForceCalc(linkedCellsContainer);
+  TestUtils::applyForceCalc(verletContainer);
+
+  TestUtils::expectEqualForces(linkedCellsContainer, verletContainer);
+  EXPECT_EQ(verletContainer.getRebuildCount(), 1);
+}
+
+/**
+ * Make sure the neighbor lists are reused while all particles moved less than skin / 2, pairs that moved into the cut
+ * off radius in the meantime are still found and the lists are rebuilt once a particle moved further.
+ */
+TEST(LinkedCellsContainerVerlet, rebuildOnlyWhenSkinExceeded) {
+  v3d left{0., 0., 0.};
+  v3d right{6., 6., 6.};
+  LinkedCellsContainer linkedCellsContainer{2., left, right};
+  LinkedCellsContainerVerlet verletContainer{2., left, right, 1.5, 0.5};
+
+  // The first two particles start outside the cut off radius, but within cut off radius + skin
+  std::vector<v3d> positions{{2.1, 3., 3.}, {3.7, 3., 3.}, {4.5, 4.5, 4.5}, {1., 1., 1.}};
+  for (auto &position : positions) {
+    linkedCellsContainer.emplace_back(position, {}, 1., 1);
+    verletContainer.emplace_back(position, {}, 1., 1);
+  }
+
+  TestUtils::applyForceCalc(verletContainer);
+  EXPECT_EQ(verletContainer.getRebuildCount(), 1);
+  EXPECT_EQ(verletContainer.getParticlesRef()[0].getF()[0], 0.);
+
+  // Move the first particle into the cut off radius of the second one, but by less than skin / 2
+  for (auto *container : std::initializer_list<LinkedCellsContainer *>{&linkedCellsContainer, &verletContainer}) {
+    resetForces(*container);
+    container->getParticlesRef()[0].setX({2.3, 3., 3.});
+  }
+
+  TestUtils::applyForceCalc(linkedCellsContainer);
+  TestUtils::applyForceCalc(verletContainer);
+  EXPECT_EQ(verletContainer.getRebuildCount(), 1);
+  EXPECT_NE(verletContainer.getParticlesRef()[0].getF()[0], 0.);
+  TestUtils::expectEqualForces(linkedCellsContainer, verletContainer);
+
+  // Moving a particle further than skin / 2 invalidates the lists
+  for (auto *container : std::initializer_list<LinkedCellsContainer *>{&linkedCellsContainer, &verletContainer}) {
+    resetForces(*container);
+    container->getParticlesRef()[3].setX({2.5, 2.5, 2.5});
+  }
+
+  TestUtils::applyForceCalc(linkedCellsContainer);
+  TestUtils::applyForceCalc(verletContainer);
+  EXPECT_EQ(verletContainer.getRebuildCount(), 2);
+  TestUtils::expectEqualForces(linkedCellsContainer, verletContainer);
+}
+
+/**
+ * Sorting the particles vector by cell invalidates the neighbor lists, since they store particle indices
+ */
+TEST(LinkedCellsContainerVerlet, rebuildOnSort) {
+  v3d left{0., 0., 0.};
+  v3d right{6., 6., 6.};
+  LinkedCellsContainer linkedCellsContainer{2., left, right};
+  LinkedCellsContainerVerlet verletContainer{2., left, right, 1.5, 0.5};
+
+  // Inserted in reverse cell order, so that the sort permutes the particles
+  std::vector<v3d> positions{{5., 5., 5.}, {4.2, 4.5, 5.}, {3., 3., 3.}, {2.1, 3., 3.}, {1., 1., 1.}, {1.5, 1., 1.}};
+  for (auto *container : std::initializer_list<LinkedCellsContainer *>{&linkedCellsContainer, &verletContainer}) {
+    container->setSortInterval(2);
+    for (auto &position : positions) container->emplace_back(position, {}, 1., 1);
+  }
+
+  // The first and third structure update sort the particles, the second one does not and nothing moves
+  std::vector<size_t> expectedRebuildCounts{1, 1, 2};
+  for (size_t expectedRebuildCount : expectedRebuildCounts) {
+    resetForces(linkedCellsContainer);
+    resetForces(verletContainer);
+    TestUtils::applyForceCalc(linkedCellsContainer);
+    TestUtils::applyForceCalc(verletContainer);
+    EXPECT_EQ(verletContainer.getRebuildCount(), expectedRebuildCount);
+    TestUtils::expectEqualForces(linkedCellsContainer, verletContainer);
+  }
+  EXPECT_EQ(verletContainer.getParticlesRef()[0].getX(), positions[4]);
+}
+
+/**
+ * Adding particles invalidates the neighbor lists
+ */
+TEST(LinkedCellsContainerVerlet, rebuildOnNewParticles) {
+  LinkedCellsContainerVerlet container{2., {0., 0., 0.}, {6., 6., 6.}, 1.5, 0.5};
+  container.emplace_back({1., 1., 1.}, {}, 1., 1);
+
+  TestUtils::applyForceCalc(container);
+  TestUtils::applyForceCalc(container);
+  EXPECT_EQ(container.getRebuildCount(), 1);
+
+  container.emplace_back({2., 1., 1.}, {}, 1., 1);
+  TestUtils::applyForceCalc(container);
+  EXPECT_EQ(container.getRebuildCount(), 2);
+  EXPECT_NE(container.getParticlesRef()[1].getF()[0], 0.);
+}
@@ -1,4 +1,7 @@
+#include <cmath>
+
 #include "dataStructures/VectorContainer.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
 #include "gtest/gtest.h"
 #include "model/Thermostat.h"
 #include "utils/ArrayUtils.h"
@@ -145,3 +148,42 @@ TEST(Thermostat, InitialTemperatureBrownian) {
   thermostat.initializeTemperature();
   EXPECT_DOUBLE_EQ(thermostat.getCurrentTemperature(), 50.);
 }
+
+/**
+ * The parallel reduction and velocity scaling of a parallel container must match the serial ones and skip deleted
+ * particles
+ */
+TEST(Thermostat, ParallelContainerMatchesSerial) {
+  v3d left{0., 0., 0.};
+  v3d right{6., 6., 6.};
+  LinkedCellsContainer serialContainer{2., left, right};
+  LinkedCellsContainerColouringSingle parallelContainer{2., left, right};
+
+  for (auto *container : {&serialContainer, static_cast<LinkedCellsContainer *>(&parallelContainer)}) {
+    for (int i = 0; i < 100; ++i) {
+      double coordinate = 0.05 * i + 0.1;
+      container->emplace_back(v3d{coordinate, coordinate, coordinate}, v3d{0.1 * i, 1., -0.5 * (i % 3)}, 1. + i % 4, 1);
+    }
+    container->getParticlesRef()[7].deleteParticle();
+  }
+
+  Thermostat serialThermostat{serialContainer, 0., 20., 100., 10, 3};
+  Thermostat parallelThermostat{parallelContainer, 0., 20., 100., 10, 3};
+  // The order of the parallel summation depends on the number of threads
+  double const tolerance = 1e-12;
+  double serialEnergy = serialThermostat.computeEnergy();
+  EXPECT_NEAR(serialEnergy, parallelThermostat.computeEnergy(), tolerance * serialEnergy);
+
+  serialThermostat.applyThermostat();
+  parallelThermostat.applyThermostat();
+  EXPECT_NEAR(parallelThermostat.getCurrentTemperature(), 20., tolerance * 20.);
+
+  auto &serialParticles = serialContainer.getParticlesRef();
+  auto &parallelParticles = parallelContainer.getParticlesRef();
+  for (size_t i = 0; i < serialParticles.size(); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double serialV = serialParticles[i].getV()[j];
+      EXPECT_NEAR(serialV, parallelParticles[i].getV()[j], tolerance * std::abs(serialV));
+    }
+  }
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringMultiple.h"
 #include "gtest/gtest.h"
 #include "utils/TestUtils.h"
@@ -68,18 +70,65 @@ TEST(LinkedCellsContainerColouringMultiple, compareResultsToLinkedCells) {
   TestUtils::applyForceCalc(linkedCellsContainer);
   TestUtils::applyForceCalc(colouringMultiple);
 
-  auto particlesLinkedCells = TestUtils::getParticleVector(linkedCellsContainer);
-  auto particlesMultipleColouring = TestUtils::getParticleVector(colouringMultiple);
+  TestUtils::expectEqualForces(linkedCellsContainer, colouringMultiple);
+}
 
-  ASSERT_EQ(particlesLinkedCells.size(), particlesMultipleColouring.size());
+/**
+ * Make sure the blocks of each colour are sorted by descending cost and skipping the blocks without pairs behind them
+ * still finds every pair of the normal linkedCellsContainer
+ */
+TEST(LinkedCellsContainerColouringMultiple, sortsBlocksByCost) {
+  v3d left{0., 0., 0.};
+  v3d right{8., 8., 8.};
+  LinkedCellsContainerColouringMultiple container{1.0, left, right};
+  LinkedCellsContainer reference{1.0, left, right};
 
-  for (size_t i = 0; i < particlesMultipleColouring.size(); ++i) {
-    Particle &a = particlesMultipleColouring[i];
-    Particle &b = particlesLinkedCells[i];
-    for (int j = 0; j < 3; ++j) {
-      EXPECT_NEAR(a.getF()[j], b.getF()[j], 0.00000001);
+  // A dense cluster in one corner and a few single particles elsewhere
+  for (int i = 0; i < 60; ++i) {
+    v3d x{1.1 + 0.03 * i, 1.2 + 0.02 * (i % 7), 1.3 + 0.1 * (i % 3)};
+    container.emplace_back(x, {}, 1., 0);
+    reference.emplace_back(x, {}, 1., 0);
+  }
+  for (double x : {4.5, 5.5, 6.5}) {
+    container.emplace_back({x, x, x}, {}, 1., 0);
+    reference.emplace_back({x, x, x}, {}, 1., 0);
+  }
+
+  size_t pairCount = 0, referencePairCount = 0;
+  std::function<void(Particle &, Particle &)> countPairs{[&pairCount](Particle &, Particle &) {
+#pragma omp atomic
+    ++pairCount;
+  }};
+  std::function<void(Particle &, Particle &)> countReferencePairs{
+      [&referencePairCount](Particle &, Particle &) { ++referencePairCount; }};
+  container.forEachPair(countPairs);
+  reference.forEachPair(countReferencePairs);
+  EXPECT_EQ(pairCount, referencePairCount);
+
+  auto &cells = container.getCellsVector();
+  auto cost = [&cells, &container](size_t index) {
+    size_t count = cells[index].particles.size();
+    if (count == 0) return size_t{0};
+    size_t pairs = count * (count - 1) / 2;
+    for (size_t offset : container.indexOffsetAdjacent) {
+      if (offset != 0) pairs += count * cells[index + offset].particles.size();
+    }
+    return pairs;
+  };
+  auto blockCost = [&cost](const std::array<size_t, 4> &block) {
+    return cost(block[0]) + cost(block[1]) + cost(block[2]) + cost(block[3]);
+  };
+
+  // Most blocks are empty, so the force calculation has to skip some of them
+  size_t emptyBlocks = 0;
+  for (auto &colour : container.getColourList()) {
+    for (size_t position = 1; position < colour.size(); ++position) {
+      EXPECT_GE(blockCost(colour[position - 1]), blockCost(colour[position])) << "Position " << position;
     }
+    emptyBlocks +=
+        std::count_if(colour.begin(), colour.end(), [&blockCost](auto &block) { return blockCost(block) == 0; });
   }
+  EXPECT_GT(emptyBlocks, 0);
 }
 
 #endif
@@ -62,16 +62,54 @@ TEST(LinkedCellsContainerColouringSingle, compareResultsToLinkedCells) {
   TestUtils::applyForceCalc(linkedCellsContainer);
   TestUtils::applyForceCalc(colouringMultiple);
 
-  auto particlesLinkedCells = TestUtils::getParticleVector(linkedCellsContainer);
-  auto particlesMultipleColouring = TestUtils::getParticleVector(colouringMultiple);
+  TestUtils::expectEqualForces(linkedCellsContainer, colouringMultiple);
+}
 
-  ASSERT_EQ(particlesLinkedCells.size(), particlesMultipleColouring.size());
+/**
+ * Make sure the cells of each colour are handed out by descending number of particle pairs and that a container with
+ * all particles in a few cells still visits every pair exactly once
+ */
+TEST(LinkedCellsContainerColouringSingle, sortsCellsByCost) {
+  v3d left{0., 0., 0.};
+  v3d right{8., 8., 8.};
+  LinkedCellsContainerColouringSingle container{1.0, left, right};
+  LinkedCellsContainer reference{1.0, left, right};
 
-  for (size_t i = 0; i < particlesMultipleColouring.size(); ++i) {
-    Particle &a = particlesMultipleColouring[i];
-    Particle &b = particlesLinkedCells[i];
-    for (int j = 0; j < 3; ++j) {
-      EXPECT_NEAR(a.getF()[j], b.getF()[j], 0.00000001);
+  // A dense cluster in one corner and a few single particles elsewhere
+  for (int i = 0; i < 60; ++i) {
+    v3d x{1.1 + 0.03 * i, 1.2 + 0.02 * (i % 7), 1.3 + 0.1 * (i % 3)};
+    container.emplace_back(x, {}, 1., 0);
+    reference.emplace_back(x, {}, 1., 0);
+  }
+  for (double x : {4.5, 5.5, 6.5}) {
+    container.emplace_back({x, x, x}, {}, 1., 0);
+    reference.emplace_back({x, x, x}, {}, 1., 0);
+  }
+
+  size_t pairCount = 0, referencePairCount = 0;
+  std::function<void(Particle &, Particle &)> countPairs{[&pairCount](Particle &, Particle &) {
+#pragma omp atomic
+    ++pairCount;
+  }};
+  std::function<void(Particle &, Particle &)> countReferencePairs{
+      [&referencePairCount](Particle &, Particle &) { ++referencePairCount; }};
+  container.forEachPair(countPairs);
+  reference.forEachPair(countReferencePairs);
+  EXPECT_EQ(pairCount, referencePairCount);
+
+  auto &cells = container.getCellsVector();
+  auto cost = [&cells, &container](size_t index) {
+    size_t count = cells[index].particles.size();
+    if (count == 0) return size_t{0};
+    size_t pairs = count * (count - 1) / 2;
+    for (size_t offset : container.indexOffsetAdjacent) {
+      if (offset != 0) pairs += count * cells[index + offset].particles.size();
+    }
+    return pairs;
+  };
+  for (auto &colour : container.getColourList()) {
+    for (size_t position = 1; position < colour.size(); ++position) {
+      EXPECT_GE(cost(colour[position - 1]), cost(colour[position])) << "Position " << position;
     }
   }
 }
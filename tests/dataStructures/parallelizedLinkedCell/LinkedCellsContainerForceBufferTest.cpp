@@ -0,0 +1,116 @@
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerForceBuffer.h"
+#include "gtest/gtest.h"
+#include "model/LennardJonesModel.h"
+#include "model/SmoothedLennardJonesModel.h"
+#include "utils/TestUtils.h"
+
+using v3d = std::array<double, 3>;
+
+#ifdef _OPENMP
+/**
+ * Make sure both reductions calculate the same forces as the normal linkedCellsContainer, including periodic
+ * boundaries, with more threads than cores and over multiple iterations, so the buffers have to be reset correctly.
+ */
+TEST(LinkedCellsContainerForceBuffer, compareResultsToLinkedCells) {
+  int threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+
+  for (auto reduction : {ForceBufferReduction::Full, ForceBufferReduction::Blocked}) {
+    LinkedCellsContainer linkedCellsContainer{1.5, left, right};
+    LinkedCellsContainerForceBuffer forceBufferContainer{1.5, left, right, reduction};
+
+    TestUtils::setupLinkedCellsContainer(linkedCellsContainer);
+    TestUtils::setupLinkedCellsContainer(forceBufferContainer);
+
+    LennardJonesModel model{1.5};
+    using P = Particle &;
+    std::function<void(P, P)> addForces{[&model](P p1, P p2) { model.addForces(p1, p2); }};
+
+    for (int iteration = 0; iteration < 3; ++iteration) {
+      for (auto *container : {&linkedCellsContainer, static_cast<LinkedCellsContainer *>(&forceBufferContainer)}) {
+        for (auto &p : container->getParticlesRef()) p.setF({0., 0., 0.});
+      }
+
+      linkedCellsContainer.forEachPair(addForces);
+      forceBufferContainer.applyForceModel(model, addForces);
+      TestUtils::expectEqualForces(linkedCellsContainer, forceBufferContainer);
+    }
+  }
+
+  omp_set_num_threads(threads);
+}
+
+/**
+ * The parallel structure update, sorting, boundaries and periodic forces must produce the same particle order and
+ * forces as the serial ones, while particles move between cells and through the periodic boundaries.
+ */
+TEST(LinkedCellsContainerForceBuffer, parallelStructureUpdatesMatchSerial) {
+  int threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+  LinkedCellsContainer linkedCellsContainer{1.5, left, right};
+  LinkedCellsContainerForceBuffer forceBufferContainer{1.5, left, right};
+
+  for (auto *container : {&linkedCellsContainer, static_cast<LinkedCellsContainer *>(&forceBufferContainer)}) {
+    TestUtils::setupLinkedCellsContainer(*container);
+    container->setSortInterval(2);
+  }
+
+  LennardJonesModel model{1.5};
+  using P = Particle &;
+  std::function<void(P, P)> addForces{[&model](P p1, P p2) { model.addForces(p1, p2); }};
+
+  for (int iteration = 0; iteration < 6; ++iteration) {
+    for (auto *container : {&linkedCellsContainer, static_cast<LinkedCellsContainer *>(&forceBufferContainer)}) {
+      auto &particles = container->getParticlesRef();
+      for (auto &p : particles) {
+        // Drift through the periodic boundaries, with a small deterministic offset per particle to shuffle the cells
+        double jitter = 0.005 * static_cast<double>(p.getId() % 7);
+        p.setX(p.getX() + v3d{0.37 + jitter, jitter, 0.23 - jitter});
+        p.setF({0., 0., 0.});
+      }
+    }
+
+    linkedCellsContainer.forEachPair(addForces);
+    forceBufferContainer.forEachPair(addForces);
+
+    auto &expected = linkedCellsContainer.getParticlesRef();
+    auto &actual = forceBufferContainer.getParticlesRef();
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(expected[i].getId(), actual[i].getId()) << "Particle " << i;
+      EXPECT_EQ(expected[i].isDeleted(), actual[i].isDeleted());
+      for (int j = 0; j < 3; ++j) EXPECT_DOUBLE_EQ(expected[i].getX()[j], actual[i].getX()[j]);
+    }
+    TestUtils::expectEqualForces(linkedCellsContainer, forceBufferContainer);
+  }
+
+  omp_set_num_threads(threads);
+}
+
+/**
+ * calculateForce must return the force addForces applies onto the first particle
+ */
+TEST(LinkedCellsContainerForceBuffer, calculateForceMatchesAddForces) {
+  std::vector<std::unique_ptr<IModel>> models;
+  models.push_back(std::make_unique<LennardJonesModel>(3.0));
+  models.push_back(std::make_unique<SmoothedLennardJonesModel>(3.0, 1.9));
+
+  for (auto &model : models) {
+    Particle a{v3d{0., 0., 0.}};
+    Particle b{v3d{1.1, 0.3, -0.2}};
+    auto force = model->calculateForce(a, b);
+    model->addForces(a, b);
+
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_DOUBLE_EQ(force[j], a.getF()[j]);
+      EXPECT_DOUBLE_EQ(-force[j], b.getF()[j]);
+    }
+  }
+}
+#endif
@@ -0,0 +1,100 @@
+#include <atomic>
+#include <numeric>
+#include <sstream>
+
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringMultiple.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerLocks.h"
+#include "gtest/gtest.h"
+#include "utils/PhaseTimers.h"
+#include "utils/TestUtils.h"
+
+#ifdef _OPENMP
+namespace {
+/**
+ * Runs one pair iteration with enabled phase timers and checks that the statistics counted exactly the pairs that
+ * were passed to the binary function
+ * @param container The container with measured load imbalance
+ * @param passCount The number of passes of the container
+ */
+void expectPairsMatch(LinkedCellsContainer &container, size_t passCount) {
+  TestUtils::setupLinkedCellsContainer(container);
+  std::atomic<std::uint64_t> pairCount{0};
+  std::function<void(Particle &, Particle &)> countPairs{[&pairCount](Particle &, Particle &) { ++pairCount; }};
+
+  PhaseTimers::enable();
+  container.forEachPair(countPairs);
+  PhaseTimers::disable();
+
+  auto *statistics = container.getLoadImbalanceStatistics();
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_EQ(statistics->getPasses().size(), passCount);
+
+  std::uint64_t passPairs = 0;
+  for (auto &pass : statistics->getPasses()) {
+    EXPECT_EQ(pass.calls, 1);
+    EXPECT_LE(pass.meanBusySeconds, pass.maxBusySeconds);
+    passPairs += pass.pairs;
+  }
+  auto threadPairs = statistics->getThreadPairs();
+  EXPECT_GT(pairCount, 0);
+  EXPECT_EQ(passPairs, pairCount);
+  EXPECT_EQ(std::accumulate(threadPairs.begin(), threadPairs.end(), std::uint64_t{0}), pairCount);
+  EXPECT_EQ(threadPairs.size(), statistics->getThreadBusySeconds().size());
+  EXPECT_GE(statistics->getImbalanceFactor(), 1.);
+}
+}  // namespace
+
+/**
+ * Make sure the statistics of all parallel containers count every pair once
+ */
+TEST(LoadImbalanceStatistics, CountsAllPairs) {
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+  LinkedCellsContainerColouringSingle single{1.5, left, right};
+  LinkedCellsContainerColouringMultiple multiple{1.5, left, right};
+  LinkedCellsContainerLocks locks{1.5, left, right};
+
+  expectPairsMatch(single, 18);
+  expectPairsMatch(multiple, 8);
+  expectPairsMatch(locks, 1);
+}
+
+/**
+ * Make sure nothing is measured while the phase timers are disabled and the table contains the imbalance factor
+ */
+TEST(LoadImbalanceStatistics, OnlyMeasuresWithPhaseTimers) {
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+  LinkedCellsContainerColouringSingle container{1.5, left, right};
+  TestUtils::setupLinkedCellsContainer(container);
+  std::function<void(Particle &, Particle &)> noForce{[](Particle &, Particle &) {}};
+
+  container.forEachPair(noForce);
+  auto &statistics = *container.getLoadImbalanceStatistics();
+  for (auto &pass : statistics.getPasses()) EXPECT_EQ(pass.calls, 0);
+  EXPECT_TRUE(statistics.getThreadBusySeconds().empty());
+  EXPECT_EQ(statistics.getImbalanceFactor(), 1.);
+
+  PhaseTimers::enable();
+  container.forEachPair(noForce);
+  PhaseTimers::disable();
+  std::stringstream table;
+  statistics.print(table);
+  EXPECT_NE(table.str().find("Colour"), std::string::npos);
+  EXPECT_NE(table.str().find("Imbalance factor"), std::string::npos);
+
+  statistics.reset();
+  EXPECT_EQ(statistics.getPasses()[0].calls, 0);
+}
+#endif
+
+/**
+ * Make sure containers without parallel passes do not report a load imbalance
+ */
+TEST(LoadImbalanceStatistics, SequentialContainersHaveNone) {
+  v3d left{0., 0., 0.};
+  v3d right{7., 3., 2.5};
+  LinkedCellsContainer container{1.5, left, right};
+  EXPECT_EQ(container.getLoadImbalanceStatistics(), nullptr);
+}
@@ -0,0 +1,119 @@
+#include <filesystem>
+#include <fstream>
+
+#include "dataStructures/LinkedCellsContainer.h"
+#include "gtest/gtest.h"
+#include "inputReader/FileReader.h"
+#include "outputWriter/CheckpointBinaryFormat.h"
+#include "outputWriter/CheckpointFileWriter.h"
+
+namespace {
+/**
+ * Container with some free particles, a deleted particle and a membrane
+ */
+void setupContainer(LinkedCellsContainer &container) {
+  container.emplace_back({1., 1., 1.}, {0.5, -0.25, 1. / 3}, 2., 1);
+  container.emplace_back({2.5, 1.5, 3.}, {1e-17, 0., 0.}, 1., 1);
+  container.emplace_back({3., 3., 3.}, {}, 1., 1);
+  container.getParticlesRef().back().deleteParticle();
+
+  for (double x : {4., 5.}) {
+    for (double y : {4., 5.}) container.emplace_back({x, y, 1.}, {}, 1., 2);
+  }
+  container.push_back(MembraneStructure({2, 2, 1}, 300., 2.2, 1.5, container.getParticlesRef()));
+
+  for (auto &p : container.getParticlesRef()) p.setF({p.getX()[0] * 0.1, -1.5, 1e-9});
+  container.getHistory(container.getParticlesRef()[1]) = {{0.5, 1.5, 2.}, {1, 0, -2}};
+}
+}  // namespace
+
+/**
+ * Make sure all particles except the deleted ones and the membranes survive a round trip through a binary checkpoint
+ * bit for bit
+ */
+TEST(CheckpointBinaryReader, RoundTrip) {
+  std::string path = (std::filesystem::temp_directory_path() / "MolSimCheckpointTest.bin").string();
+  LinkedCellsContainer written{3., {0., 0., 0.}, {6., 6., 6.}};
+  setupContainer(written);
+
+  CheckpointFileWriter writer{path};
+  writer.writeFile(writer.getOutputFile(), 0, written);
+  ASSERT_TRUE(CheckpointBinaryReader::isBinaryCheckpoint(path.c_str()));
+
+  LinkedCellsContainer read{3., {0., 0., 0.}, {6., 6., 6.}};
+  FileReader::readFileCheckpoint(read, path.data());
+  std::filesystem::remove(path);
+
+  auto &expected = written.getParticlesRef();
+  auto &actual = read.getParticlesRef();
+  ASSERT_EQ(actual.size(), expected.size() - 1);
+  for (size_t i = 0, j = 0; i < expected.size(); ++i) {
+    if (expected[i].isDeleted()) continue;
+    auto &a = actual[j++];
+    EXPECT_EQ(a.getX(), expected[i].getX());
+    EXPECT_EQ(a.getV(), expected[i].getV());
+    EXPECT_EQ(a.getF(), expected[i].getF());
+    EXPECT_EQ(a.getOldF(), expected[i].getOldF());
+    EXPECT_EQ(a.getM(), expected[i].getM());
+    EXPECT_EQ(a.getType(), expected[i].getType());
+    EXPECT_EQ(a.getEpsilon(), expected[i].getEpsilon());
+    EXPECT_EQ(a.getSigma(), expected[i].getSigma());
+    EXPECT_EQ(read.getHistory(a).lastPosition, written.getHistory(expected[i]).lastPosition);
+    EXPECT_EQ(read.getHistory(a).periodicBoundariesCrossed, written.getHistory(expected[i]).periodicBoundariesCrossed);
+  }
+
+  ASSERT_EQ(read.getStructureVectorRef().size(), 1);
+  auto &membrane = read.getStructureVectorRef()[0];
+  EXPECT_EQ(membrane.getStartIndex(), 2);
+  EXPECT_EQ(membrane.getDimensions(), (std::array<size_t, 3>{2, 2, 1}));
+  EXPECT_EQ(membrane.getStiffness(), 300.);
+  EXPECT_EQ(membrane.getBondLength(), 2.2);
+  EXPECT_DOUBLE_EQ(membrane.getHarmonicCutOff(), 1.5);
+  for (auto &p : membrane) EXPECT_TRUE(p.isInStructure());
+}
+
+/**
+ * Make sure truncated files are rejected instead of reading past the end of the mapping
+ */
+TEST(CheckpointBinaryReader, RejectTruncatedFile) {
+  std::string path = (std::filesystem::temp_directory_path() / "MolSimCheckpointTruncatedTest.bin").string();
+  LinkedCellsContainer written{3., {0., 0., 0.}, {6., 6., 6.}};
+  setupContainer(written);
+
+  CheckpointFileWriter writer{path};
+  writer.writeFile(writer.getOutputFile(), 0, written);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+
+  LinkedCellsContainer read{3., {0., 0., 0.}, {6., 6., 6.}};
+  EXPECT_THROW(CheckpointBinaryReader::readFile(read, path.c_str()), std::runtime_error);
+  EXPECT_EQ(read.size(), 0);
+  std::filesystem::remove(path);
+}
+
+/**
+ * Make sure counts whose record sizes overflow to the size of the file are rejected
+ */
+TEST(CheckpointBinaryReader, RejectOverflowingCount) {
+  using CheckpointBinaryFormat::Header;
+  std::string path = (std::filesystem::temp_directory_path() / "MolSimCheckpointOverflowTest.bin").string();
+  LinkedCellsContainer written{3., {0., 0., 0.}, {6., 6., 6.}};
+  setupContainer(written);
+
+  CheckpointFileWriter writer{path};
+  writer.writeFile(writer.getOutputFile(), 0, written);
+
+  // The records are a multiple of 8 bytes long, so 2^61 additional types add a multiple of 2^64 bytes
+  {
+    std::fstream file{path, std::ios::in | std::ios::out | std::ios::binary};
+    Header header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(Header));
+    header.typeCount += std::uint64_t{1} << 61;
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+  }
+
+  LinkedCellsContainer read{3., {0., 0., 0.}, {6., 6., 6.}};
+  EXPECT_THROW(CheckpointBinaryReader::readFile(read, path.c_str()), std::runtime_error);
+  EXPECT_EQ(read.size(), 0);
+  std::filesystem::remove(path);
+}
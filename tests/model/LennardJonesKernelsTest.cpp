@@ -0,0 +1,97 @@
+#include "model/LennardJonesKernels.h"
+
+#include <numeric>
+#include <random>
+
+#include "gtest/gtest.h"
+
+using LennardJonesKernels::KernelType;
+
+namespace {
+/**
+ * Fills a structure of arrays with particles at random positions within a 3x3x3 box and with mixed parameters
+ */
+ParticleSoA makeRandomSoA(size_t count) {
+  Particle::registerParticleType(11, 1.0, 1.0);
+  Particle::registerParticleType(12, 1.5, 0.9);
+  Particle::registerParticleType(13, 2.0, 0.8);
+
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> position{0., 3.};
+  std::uniform_int_distribution<int> type{11, 13};
+
+  std::vector<Particle> particles;
+  for (size_t i = 0; i < count; ++i) {
+    std::array<double, 3> x{position(generator), position(generator), position(generator)};
+    particles.emplace_back(x, std::array<double, 3>{}, 1., type(generator));
+  }
+
+  std::vector<size_t> order(particles.size());
+  std::iota(order.begin(), order.end(), 0);
+  ParticleSoA soa;
+  soa.load(particles, order);
+  return soa;
+}
+}  // namespace
+
+/**
+ * Every kernel supported by the CPU has to calculate the same forces as the scalar kernel, including ranges that are
+ * not a multiple of the vector width.
+ */
+TEST(LennardJonesKernels, vectorizedKernelsMatchScalar) {
+  for (auto type : {KernelType::AVX2, KernelType::AVX512}) {
+    if (!LennardJonesKernels::isSupported(type)) continue;
+    auto kernel = LennardJonesKernels::getKernel(type);
+
+    for (size_t count : {2, 5, 9, 16, 23}) {
+      auto expected = makeRandomSoA(count);
+      auto actual = makeRandomSoA(count);
+
+      for (size_t i = 0; i < count; ++i) {
+        LennardJonesKernels::scalarKernel(expected, i, i + 1, count, 2.25);
+        kernel(actual, i, i + 1, count, 2.25);
+      }
+
+      for (size_t i = 0; i < count; ++i) {
+        EXPECT_NEAR(expected.fx[i], actual.fx[i], 1e-8 + 1e-12 * std::abs(expected.fx[i]))
+            << LennardJonesKernels::getName(type) << " particle " << i << " of " << count;
+        EXPECT_NEAR(expected.fy[i], actual.fy[i], 1e-8 + 1e-12 * std::abs(expected.fy[i]));
+        EXPECT_NEAR(expected.fz[i], actual.fz[i], 1e-8 + 1e-12 * std::abs(expected.fz[i]));
+      }
+    }
+  }
+}
+
+/**
+ * Pairs at or beyond the cut off radius must not receive any force.
+ */
+TEST(LennardJonesKernels, pairsBeyondCutOffAreMasked) {
+  std::vector<Particle> particles;
+  for (int i = 0; i < 10; ++i) particles.emplace_back(std::array<double, 3>{1.5 * i, 0., 0.});
+  std::vector<size_t> order(particles.size());
+  std::iota(order.begin(), order.end(), 0);
+
+  for (auto type : {KernelType::Scalar, KernelType::AVX2, KernelType::AVX512}) {
+    if (!LennardJonesKernels::isSupported(type)) continue;
+
+    ParticleSoA soa;
+    soa.load(particles, order);
+    LennardJonesKernels::getKernel(type)(soa, 0, 1, particles.size(), 1.5 * 1.5);
+
+    for (size_t i = 0; i < particles.size(); ++i) EXPECT_EQ(soa.fx[i], 0.) << LennardJonesKernels::getName(type);
+  }
+}
+
+/**
+ * The scalar kernel is always available, unsupported kernels cannot be selected.
+ */
+TEST(LennardJonesKernels, kernelSelection) {
+  EXPECT_TRUE(LennardJonesKernels::isSupported(KernelType::Scalar));
+  EXPECT_TRUE(LennardJonesKernels::isSupported(LennardJonesKernels::detectKernelType()));
+
+  for (auto type : {KernelType::AVX2, KernelType::AVX512}) {
+    if (!LennardJonesKernels::isSupported(type)) {
+      EXPECT_THROW(LennardJonesKernels::getKernel(type), std::invalid_argument);
+    }
+  }
+}
@@ -87,4 +87,64 @@ TEST(LennardJonesModel, ForceMixingRules) {
     EXPECT_NEAR(p1.getF().at(i), expected_force.at(i), 0.01);
     EXPECT_NEAR(p2.getF().at(i), ((-1.0) * expected_force).at(i), 0.01);
   }
-}
\ No newline at end of file
+}
+
+/**
+ * Make sure the accumulated potential energy and virial match the Lennard-Jones potential, including its minimum of
+ * -epsilon at 2^(1/6) * sigma, and that the forces match addForces
+ */
+TEST(LennardJonesModel, Observables) {
+  LennardJonesModel model{3.};
+  double epsilon = 5.;
+
+  Particle p1{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  Particle p2{{std::pow(2., 1. / 6), 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  PairObservables observables;
+  model.addForcesAndObservables(p1, p2, observables);
+  EXPECT_NEAR(observables.potentialEnergy, -p1.getEpsilon(), 1e-12);
+  EXPECT_EQ(p1.getEpsilon(), epsilon);
+  EXPECT_NEAR(observables.virial, 0., 1e-12);
+
+  Particle p3{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  Particle p4{{1.0, 0.5, 0.0}, {0.0, 0.0, 0.0}};
+  Particle p5{p3};
+  Particle p6{p4};
+  observables = {};
+  model.addForcesAndObservables(p3, p4, observables);
+  model.addForces(p5, p6);
+  EXPECT_EQ(p3.getF(), p5.getF());
+  EXPECT_EQ(p4.getF(), p6.getF());
+
+  double r2 = 1.25;
+  double s6 = 1. / (r2 * r2 * r2);
+  EXPECT_NEAR(observables.potentialEnergy, 4 * epsilon * (s6 * s6 - s6), 1e-12);
+  auto distance = p3.getX() - p4.getX();
+  auto &force = p3.getF();
+  EXPECT_NEAR(observables.virial, distance[0] * force[0] + distance[1] * force[1] + distance[2] * force[2], 1e-12);
+
+  // Beyond the cut off radius nothing is accumulated
+  Particle p7{{4.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  model.addForcesAndObservables(p3, p7, observables);
+  EXPECT_NEAR(observables.potentialEnergy, 4 * epsilon * (s6 * s6 - s6), 1e-12);
+}
+
+/**
+ * Make sure particles created before their type got registered use the registered parameters, since the parameters
+ * are determined by the type
+ */
+TEST(LennardJonesModel, LateTypeRegistration) {
+  Particle p1{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, 1.0, 21};
+  EXPECT_EQ(p1.getEpsilon(), 5.0);
+  EXPECT_EQ(p1.getSigma(), 1.0);
+
+  Particle::registerParticleType(21, 2.0, 1.2);
+  Particle p2{{1.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, 1.0, 22};
+  EXPECT_EQ(p1.getEpsilon(), 2.0);
+  EXPECT_EQ(p1.getSigma(), 1.2);
+
+  auto &mixed = Particle::getPairParameters(p1.getTypeIndex(), p2.getTypeIndex());
+  EXPECT_DOUBLE_EQ(mixed.epsilon, std::sqrt(2.0 * 5.0));
+  EXPECT_DOUBLE_EQ(mixed.sigma, 1.1);
+  EXPECT_DOUBLE_EQ(mixed.epsilon24, 24 * std::sqrt(2.0 * 5.0));
+  EXPECT_DOUBLE_EQ(mixed.sigmaSquared, 1.1 * 1.1);
+}
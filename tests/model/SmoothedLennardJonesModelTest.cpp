@@ -16,7 +16,8 @@ TEST(SmoothedLennardJonesModel, ForceNew) {
 
   Particle p2{{distance, 0.0, 0.0}, {0.0, 0.0, 0.0}};
 
-  std::array<double, 3> expected_force = {0.56649460220233661 * 2.1, 0.0, 0.0};
+  // The exact derivative of the potential for the double values of the distance and radii, correctly rounded
+  std::array<double, 3> expected_force = {1.1896386646249044, 0.0, 0.0};
 
   SmoothedLennardJonesModel model{2.3, 1.9};
 
@@ -95,4 +96,34 @@ TEST(SmoothedLennardJonesModel, ForceNewNull) {
   EXPECT_NEAR(p1.getF()[0], expected_force[0], 0.00000000000001);
   EXPECT_NEAR(p1.getF()[0], expected_force[0], std::numeric_limits<double>::epsilon())
       << "Note: this last expect might assume unreasonable precision.";
-}
\ No newline at end of file
+}
+
+/**
+ * Make sure the accumulated potential is consistent with the force, i.e. the force is the negative derivative of the
+ * potential, both below radius_l and within the smoothing range, and the virial is r * F
+ */
+TEST(SmoothedLennardJonesModel, ObservablesMatchForce) {
+  SmoothedLennardJonesModel model{2.3, 1.9};
+
+  auto observe = [&model](double distance) {
+    Particle p1{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+    Particle p2{{distance, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+    PairObservables observables;
+    model.addForcesAndObservables(p1, p2, observables);
+    return std::make_pair(observables, p1.getF()[0]);
+  };
+
+  double h = 1e-6;
+  for (double distance : {1.2, 1.8, 2.0, 2.1, 2.25}) {
+    auto [observables, force] = observe(distance);
+    double derivative = (observe(distance + h).first.potentialEnergy - observe(distance - h).first.potentialEnergy) /
+                        (2 * h);
+
+    // p2 lies in positive x direction of p1, so a repulsive force on p1 is negative
+    EXPECT_NEAR(force, derivative, 1e-6 * std::max(1., std::abs(force))) << "Distance " << distance;
+    EXPECT_NEAR(observables.virial, -force * distance, 1e-12 * std::max(1., std::abs(force)))
+        << "Distance " << distance;
+  }
+
+  EXPECT_NEAR(observe(2.3).first.potentialEnergy, 0., 1e-12);
+}
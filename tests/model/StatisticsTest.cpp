@@ -1,5 +1,9 @@
+#include <numeric>
+
 #include "dataStructures/Particle.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
 #include "gtest/gtest.h"
+#include "utils/RadialDistributionObserver.h"
 #include "utils/ThermodynamicStatistics.h"
 #define PI 3.14159265358979323846
 
@@ -12,16 +16,18 @@ TEST(ThermodynamicStatisticsTest, VarianceTest) {
   Particle p2{{4.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
   Particle p3{{8.3, 0.0, 0.0}, {0.0, 0.0, 0.0}};
   Particle p4{{9.1, 0.0, 0.0}, {0.0, 0.0, 0.0}};
-  p1.setLastPosition({1., 3., 4.});
-  p2.setLastPosition({2., 3., 5.});
-  p3.setLastPosition({1., 2., 6.});
-  p4.setLastPosition({5., 0., -3});
 
   container.push_back(p1);
   container.push_back(p2);
   container.push_back(p3);
   container.push_back(p4);
 
+  auto &particles = container.getParticlesRef();
+  container.getHistory(particles[0]).lastPosition = {1., 3., 4.};
+  container.getHistory(particles[1]).lastPosition = {2., 3., 5.};
+  container.getHistory(particles[2]).lastPosition = {1., 2., 6.};
+  container.getHistory(particles[3]).lastPosition = {5., 0., -3};
+
   double variance = statistics.calculateVariance(&container);
   double expectedVariance = 45.775;
   EXPECT_NEAR(variance, expectedVariance, 0.00000001);
@@ -46,4 +52,113 @@ TEST(ThermodynamicStatisticsTest, RDFTestDensity) {
   for (int i = 0; i < 4; i++) {
     EXPECT_NEAR(result[i], expected[i], 0.00000001);
   }
-}
\ No newline at end of file
+}
+
+/**
+ * Make sure the grid based rdf counts the same pairs as a direct loop over all pairs, for bins spanning several cells
+ * of the grid
+ */
+TEST(ThermodynamicStatisticsTest, RDFMatchesAllPairs) {
+  VectorContainer container{};
+  for (int i = 0; i < 400; ++i) {
+    double jitter = 0.1 * ((i * 37) % 11);
+    container.emplace_back({(i % 8) * 1.3 + jitter, ((i / 8) % 10) * 0.9, (i / 80) * 1.7 - jitter}, {}, 1., 0);
+  }
+
+  double deltaR = 0.25;
+  double start = 0.5;
+  double end = 3.;
+  std::vector<double> result = ThermodynamicStatistics::calculateRadialDistributionFunction(deltaR, &container, start,
+                                                                                             end);
+
+  auto &particles = container.getParticlesRef();
+  std::vector<double> expected;
+  for (double i = start; i <= end; i += deltaR) {
+    double numPairs = 0;
+    for (size_t j = 0; j < particles.size(); ++j) {
+      for (size_t k = j + 1; k < particles.size(); ++k) {
+        double r = ArrayUtils::L2Norm(particles[j].getX() - particles[k].getX());
+        if (r > i && r <= i + deltaR) numPairs++;
+      }
+    }
+    expected.push_back((3.0 * numPairs) / (4 * PI * ((i + deltaR) * (i + deltaR) * (i + deltaR) - i * i * i)));
+  }
+
+  ASSERT_EQ(result.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) EXPECT_DOUBLE_EQ(result[i], expected[i]) << "Bin " << i;
+}
+
+/**
+ * Make sure the rdf accumulated while a parallel container visits the pairs matches the one of the separate pass, if
+ * the largest bin lies within the cell size
+ */
+TEST(ThermodynamicStatisticsTest, RDFObserverMatchesSeparatePass) {
+  v3d left{0., 0., 0.};
+  v3d right{12., 12., 12.};
+  LinkedCellsContainerColouringSingle container{3., left, right};
+  for (int i = 0; i < 500; ++i) {
+    double jitter = 0.07 * ((i * 37) % 13);
+    container.emplace_back({(i % 10) * 1.1 + jitter, ((i / 10) % 10) * 1.15 + 0.3, (i / 100) * 2.3 + jitter}, {}, 1.,
+                           0);
+  }
+
+  RadialDistributionObserver observer{0.25, 0.5, 2.5};
+  ASSERT_LE(observer.getMaxDistance(), 3.);
+  std::function<void(Particle &, Particle &)> observe{[&observer](Particle &p1, Particle &p2) {
+    observer.observe(p1, p2);
+  }};
+  observer.beginTraversal();
+  container.forEachPair(observe);
+  observer.endTraversal();
+
+  std::vector<double> densities;
+  ASSERT_TRUE(observer.takeDensities(densities));
+  EXPECT_FALSE(observer.takeDensities(densities));
+
+  auto expected = ThermodynamicStatistics::calculateRadialDistributionFunction(0.25, &container, 0.5, 2.5);
+  ASSERT_EQ(densities.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) EXPECT_DOUBLE_EQ(densities[i], expected[i]) << "Bin " << i;
+}
+
+/**
+ * Make sure the rdf accumulated while a parallel container visits the pairs and the periodic images matches the one of
+ * the separate pass, which uses the nearest periodic image of each pair
+ */
+TEST(ThermodynamicStatisticsTest, RDFObserverMatchesSeparatePassPeriodic) {
+  v3d left{0., 0., 0.};
+  v3d right{12., 12., 12.};
+  LinkedCellsContainerColouringSingle container{3., left, right};
+  container.setBoundaries({{CubeSide::LEFT, BoundaryType::PERIODIC},
+                           {CubeSide::RIGHT, BoundaryType::PERIODIC},
+                           {CubeSide::TOP, BoundaryType::PERIODIC},
+                           {CubeSide::BOTTOM, BoundaryType::PERIODIC},
+                           {CubeSide::FRONT, BoundaryType::PERIODIC},
+                           {CubeSide::BACK, BoundaryType::PERIODIC}});
+  VectorContainer open{};
+  for (int i = 0; i < 500; ++i) {
+    double jitter = 0.07 * ((i * 37) % 13);
+    v3d x{(i % 10) * 1.2 + jitter, ((i / 10) % 10) * 1.18 + 0.3, (i / 100) * 2.4 + jitter};
+    container.emplace_back(x, {}, 1., 0);
+    open.emplace_back(x, {}, 1., 0);
+  }
+
+  RadialDistributionObserver observer{0.25, 0.5, 2.5};
+  std::function<void(Particle &, Particle &)> observe{[&observer](Particle &p1, Particle &p2) {
+    observer.observe(p1, p2);
+  }};
+  observer.beginTraversal();
+  container.forEachPair(observe);
+  observer.endTraversal();
+
+  std::vector<double> densities;
+  ASSERT_TRUE(observer.takeDensities(densities));
+
+  auto expected = ThermodynamicStatistics::calculateRadialDistributionFunction(0.25, &container, 0.5, 2.5);
+  ASSERT_EQ(densities.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) EXPECT_DOUBLE_EQ(densities[i], expected[i]) << "Bin " << i;
+
+  // The pairs through the periodic boundaries were counted
+  auto withoutImages = ThermodynamicStatistics::calculateRadialDistributionFunction(0.25, &open, 0.5, 2.5);
+  EXPECT_GT(std::accumulate(expected.begin(), expected.end(), 0.),
+            std::accumulate(withoutImages.begin(), withoutImages.end(), 0.));
+}
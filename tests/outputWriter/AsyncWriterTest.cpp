@@ -0,0 +1,65 @@
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "dataStructures/VectorContainer.h"
+#include "gtest/gtest.h"
+#include "outputWriter/AsyncWriter.h"
+
+namespace {
+/**
+ * Records the first position of each written snapshot, optionally slowly or failing
+ */
+class RecordingWriter : public IWriter {
+ public:
+  std::vector<std::pair<int, double>> &written;
+  std::chrono::milliseconds delay;
+  bool fail;
+
+  RecordingWriter(std::vector<std::pair<int, double>> &written, std::chrono::milliseconds delay, bool fail = false)
+      : written{written}, delay{delay}, fail{fail} {}
+
+  void writeFile(const std::string &filename, int iteration, IContainer &particles) override {
+    std::this_thread::sleep_for(delay);
+    if (fail) throw std::runtime_error("Writing failed");
+    written.emplace_back(iteration, particles.getParticlesRef().at(0).getX()[0]);
+  }
+};
+}  // namespace
+
+/**
+ * Make sure the snapshots are written in order and hold the state of the particles at the time of writeFile, even if
+ * the particles are modified while the writer thread is still busy and the queue is full
+ */
+TEST(AsyncWriter, WritesSnapshotsInOrder) {
+  std::vector<std::pair<int, double>> written;
+  AsyncWriter writer{std::make_unique<RecordingWriter>(written, std::chrono::milliseconds(5)), 1};
+
+  VectorContainer container{};
+  container.emplace_back({0., 0., 0.}, {}, 1., 0);
+  for (int iteration = 0; iteration < 10; ++iteration) {
+    container.getParticlesRef()[0].setX({static_cast<double>(iteration), 0., 0.});
+    writer.writeFile("unused", iteration, container);
+  }
+  writer.flush();
+
+  ASSERT_EQ(written.size(), 10);
+  for (int iteration = 0; iteration < 10; ++iteration) {
+    EXPECT_EQ(written[iteration].first, iteration);
+    EXPECT_EQ(written[iteration].second, static_cast<double>(iteration));
+  }
+}
+
+/**
+ * Make sure exceptions of the writer thread reach the simulation thread
+ */
+TEST(AsyncWriter, RethrowsWriterErrors) {
+  std::vector<std::pair<int, double>> written;
+  AsyncWriter writer{std::make_unique<RecordingWriter>(written, std::chrono::milliseconds(0), true)};
+
+  VectorContainer container{};
+  container.emplace_back({0., 0., 0.}, {}, 1., 0);
+  writer.writeFile("unused", 0, container);
+  EXPECT_THROW(writer.flush(), std::runtime_error);
+  EXPECT_NO_THROW(writer.flush());
+}
@@ -0,0 +1,106 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "Simulation.h"
+#include "dataStructures/LinkedCellsContainer.h"
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
+#include "gtest/gtest.h"
+#include "model/LennardJonesModel.h"
+#include "outputWriter/NoWriter.h"
+#include "utils/ArrayUtils.h"
+
+using v3d = std::array<double, 3>;
+
+namespace {
+/**
+ * Reads the value of the last line of the statistics file that starts with the given label
+ * @param content The whole statistics file
+ * @param label The label of the value, e.g. "Epot: "
+ * @return The value
+ */
+double readLastValue(const std::string &content, const std::string &label) {
+  size_t position = content.rfind(label);
+  if (position == std::string::npos) throw std::runtime_error("Missing " + label);
+  return std::stod(content.substr(position + label.size(), content.find('\n', position) - position - label.size()));
+}
+
+/**
+ * Runs a few iterations with statistics on a small cluster and checks the potential energy, virial and pressure of the
+ * last iteration, which is a statistics iteration, against a direct computation from the final particle state
+ * @param container An empty container with the domain [0, 6]³ and a cell size of at least the cut off radius
+ */
+void expectStatisticsMatchDirectComputation(LinkedCellsContainer &container) {
+  double const cutOffRadius = 3.;
+  for (int i = 0; i < 12; ++i) {
+    container.emplace_back({2. + 1.15 * (i % 3), 2. + 1.1 * ((i / 3) % 2), 2.5 + 1.2 * (i / 6)},
+                           {0.1 * (i % 4), -0.2 * (i % 3), 0.05 * i}, 1. + 0.5 * (i % 2), 0);
+  }
+
+  std::string path = (std::filesystem::temp_directory_path() / "MolSimStatisticsWriterTest.txt").string();
+  LennardJonesModel model{cutOffRadius};
+  double const deltaT = 1. / 128;
+  model.setDeltaT(deltaT);
+  NoWriter writer{};
+  Thermostat thermostat{container, 0., 0., 0., 0, 3};
+  CheckpointFileWriter checkpointWriter{""};
+  StatisticsWriter statisticsWriter{container, 3, path, 0.5, 0.5, 2.};
+  statisticsWriter.enablePairObservation(cutOffRadius);
+
+  // Iterations 0 to 3, the last one writes the statistics
+  Simulation simulation{};
+  simulation.setDeltaT(deltaT);
+  simulation.setEndTime(4 * deltaT);
+  simulation.setIterationsPerWrite(1);
+  simulation.simulate(model, container, writer, thermostat, 0., false, false, true, checkpointWriter,
+                      statisticsWriter);
+
+  double potentialEnergy = 0., virial = 0., kineticEnergy = 0.;
+  auto &particles = container.getParticlesRef();
+  for (size_t i = 0; i < particles.size(); ++i) {
+    kineticEnergy += 0.5 * particles[i].getM() * ArrayUtils::dotProduct(particles[i].getV());
+    for (size_t j = i + 1; j < particles.size(); ++j) {
+      double distanceSquared = ArrayUtils::dotProduct(particles[i].getX() - particles[j].getX());
+      if (distanceSquared >= cutOffRadius * cutOffRadius) continue;
+
+      double epsilon = particles[i].getEpsilon();
+      double sixthPower = std::pow(particles[i].getSigma() * particles[i].getSigma() / distanceSquared, 3);
+      potentialEnergy += 4 * epsilon * (sixthPower * sixthPower - sixthPower);
+      virial += 24 * epsilon * (2 * sixthPower * sixthPower - sixthPower);
+    }
+  }
+  double pressure = (2 * kineticEnergy + virial) / (3 * 6. * 6. * 6.);
+
+  std::ifstream file{path};
+  std::stringstream content;
+  content << file.rdbuf();
+  file.close();
+  std::filesystem::remove(path);
+
+  EXPECT_NE(content.str().find("Iteration: 3"), std::string::npos);
+  EXPECT_NE(potentialEnergy, 0.);
+  EXPECT_NEAR(readLastValue(content.str(), "Epot: "), potentialEnergy, 1e-10 * std::abs(potentialEnergy));
+  EXPECT_NEAR(readLastValue(content.str(), "Virial: "), virial, 1e-10 * std::abs(virial));
+  EXPECT_NEAR(readLastValue(content.str(), "Pressure: "), pressure, 1e-10 * std::abs(pressure));
+}
+}  // namespace
+
+/**
+ * Make sure the simulation writes the potential energy, virial and pressure of the statistics iterations
+ */
+TEST(StatisticsWriter, WritesPairObservables) {
+  v3d left{0., 0., 0.};
+  v3d right{6., 6., 6.};
+  LinkedCellsContainer container{3., left, right};
+  expectStatisticsMatchDirectComputation(container);
+}
+
+/**
+ * Same as WritesPairObservables, with a parallel container that accumulates the observables per thread
+ */
+TEST(StatisticsWriter, WritesPairObservablesParallel) {
+  v3d left{0., 0., 0.};
+  v3d right{6., 6., 6.};
+  LinkedCellsContainerColouringSingle container{3., left, right};
+  expectStatisticsMatchDirectComputation(container);
+}
@@ -0,0 +1,59 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "dataStructures/VectorContainer.h"
+#include "gtest/gtest.h"
+#include "outputWriter/VTKWriter.h"
+
+namespace {
+/**
+ * Reads the values of a data array from the appended section of a .vtu file
+ * @param content The whole file
+ * @param name The name of the data array
+ */
+template <typename T>
+std::vector<T> readDataArray(const std::string &content, const std::string &name) {
+  size_t element = content.find("Name=\"" + name + "\"");
+  size_t offsetStart = content.find("offset=\"", element) + 8;
+  size_t offset = std::stoul(content.substr(offsetStart, content.find('"', offsetStart) - offsetStart));
+  size_t data = content.find("<AppendedData encoding=\"raw\">");
+  data = content.find('_', data) + 1 + offset;
+
+  std::uint64_t bytes;
+  std::memcpy(&bytes, content.data() + data, sizeof(bytes));
+  std::vector<T> values(bytes / sizeof(T));
+  std::memcpy(values.data(), content.data() + data + sizeof(bytes), bytes);
+  return values;
+}
+}  // namespace
+
+/**
+ * Make sure the data arrays in the appended section hold the values of the particles in the right order
+ */
+TEST(VTKWriter, AppendedDataMatchesParticles) {
+  VectorContainer container{};
+  container.emplace_back({1., 2., 3.}, {0.5, -0.5, 0.25}, 2., 1);
+  container.emplace_back({-4., 5.5, 0.}, {}, 3., 7);
+
+  std::string base = (std::filesystem::temp_directory_path() / "MolSimVTKWriterTest").string();
+  VTKWriter writer{};
+  writer.writeFile(base, 3, container);
+
+  std::string path = base + "_0003.vtu";
+  std::ifstream file(path, std::ios::binary);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  std::string content = buffer.str();
+  std::filesystem::remove(path);
+
+  EXPECT_NE(content.find("NumberOfPoints=\"2\""), std::string::npos);
+  EXPECT_EQ(readDataArray<float>(content, "mass"), (std::vector<float>{2.f, 3.f}));
+  EXPECT_EQ(readDataArray<std::int32_t>(content, "type"), (std::vector<std::int32_t>{1, 7}));
+  EXPECT_EQ(readDataArray<float>(content, "velocity"), (std::vector<float>{0.5f, -0.5f, 0.25f, 0.f, 0.f, 0.f}));
+  EXPECT_EQ(readDataArray<float>(content, "points"), (std::vector<float>{1.f, 2.f, 3.f, -4.f, 5.5f, 0.f}));
+  EXPECT_TRUE(readDataArray<std::int32_t>(content, "connectivity").empty());
+  EXPECT_NE(content.find("</VTKFile>"), std::string::npos);
+}
@@ -0,0 +1,103 @@
+#include <fstream>
+#include <sstream>
+
+#include "dataStructures/LinkedCellsContainer.h"
+#include "gtest/gtest.h"
+#include "utils/PhaseTimers.h"
+
+namespace {
+/**
+ * @return The summary of the given phase
+ */
+PhaseTimers::PhaseSummary getSummary(Phase phase) { return PhaseTimers::summarize()[static_cast<size_t>(phase)]; }
+}  // namespace
+
+/**
+ * Make sure disabled timers do not record anything
+ */
+TEST(PhaseTimers, DisabledTimersRecordNothing) {
+  PhaseTimers::enable();
+  PhaseTimers::disable();
+  { ScopedPhaseTimer timer{Phase::Output}; }
+
+  EXPECT_EQ(getSummary(Phase::Output).calls, 0);
+  EXPECT_EQ(getSummary(Phase::Output).seconds, 0.);
+}
+
+/**
+ * Make sure every timer adds one call and its duration to its phase, also when it is stopped early
+ */
+TEST(PhaseTimers, RecordsCallsAndTime) {
+  PhaseTimers::enable();
+  for (int i = 0; i < 3; ++i) {
+    ScopedPhaseTimer timer{Phase::Thermostat};
+    volatile double sum = 0.;
+    for (int j = 0; j < 100000; ++j) sum = sum + j;
+  }
+  {
+    ScopedPhaseTimer timer{Phase::Statistics};
+    timer.stop();
+    timer.stop();
+  }
+  PhaseTimers::disable();
+
+  auto thermostat = getSummary(Phase::Thermostat);
+  EXPECT_EQ(thermostat.calls, 3);
+  EXPECT_GT(thermostat.seconds, 0.);
+  EXPECT_FALSE(thermostat.isSubphase);
+  EXPECT_EQ(getSummary(Phase::Statistics).calls, 1);
+  EXPECT_EQ(getSummary(Phase::Integration).calls, 0);
+
+  PhaseTimers::reset();
+  EXPECT_EQ(getSummary(Phase::Thermostat).calls, 0);
+}
+
+/**
+ * Make sure the phases of the linked cells container are recorded as sub phases of the force calculation
+ */
+TEST(PhaseTimers, RecordsContainerPhases) {
+  LinkedCellsContainer container{3., {0., 0., 0.}, {9., 9., 9.}};
+  container.emplace_back({1., 1., 1.}, {}, 1., 0);
+  container.emplace_back({2., 1., 1.}, {}, 1., 0);
+  std::function<void(Particle &, Particle &)> countPairs{[](Particle &, Particle &) {}};
+
+  PhaseTimers::enable();
+  container.forEachPair(countPairs);
+  PhaseTimers::disable();
+
+  for (auto phase : {Phase::Rebinning, Phase::Boundaries, Phase::PairLoop}) {
+    auto summary = getSummary(phase);
+    EXPECT_EQ(summary.calls, 1) << summary.name;
+    EXPECT_TRUE(summary.isSubphase) << summary.name;
+  }
+}
+
+/**
+ * Make sure the table and the JSON file contain the measured phases and the untimed rest
+ */
+TEST(PhaseTimers, WritesTableAndJson) {
+  PhaseTimers::enable();
+  { ScopedPhaseTimer timer{Phase::Integration}; }
+  { ScopedPhaseTimer timer{Phase::PairLoop}; }
+  PhaseTimers::disable();
+
+  std::stringstream table;
+  PhaseTimers::printTable(table, 1.);
+  EXPECT_NE(table.str().find("Integration"), std::string::npos);
+  EXPECT_NE(table.str().find("  Pair loop"), std::string::npos);
+  EXPECT_NE(table.str().find("Not timed"), std::string::npos);
+  EXPECT_EQ(table.str().find("Thermostat"), std::string::npos);
+
+  PhaseTimers::writeJson("phaseTimersTest.json", 1.);
+  std::ifstream file{"phaseTimersTest.json"};
+  std::stringstream json;
+  json << file.rdbuf();
+  EXPECT_NE(json.str().find("\"totalSeconds\": 1"), std::string::npos);
+  EXPECT_NE(json.str().find("{\"name\": \"Integration\", \"parent\": null, \"calls\": 1"), std::string::npos);
+  EXPECT_NE(json.str().find("{\"name\": \"Pair loop\", \"parent\": \"Force calculation\", \"calls\": 1"),
+            std::string::npos);
+  std::remove("phaseTimersTest.json");
+
+  EXPECT_THROW(PhaseTimers::writeJson("missingDirectory/phaseTimers.json", 1.), std::runtime_error);
+  PhaseTimers::reset();
+}
@@ -1,5 +1,9 @@
 #include "TestUtils.h"
 
+#include <cmath>
+
+#include "gtest/gtest.h"
+
 VectorContainer TestUtils::makeContainer(unsigned size) {
   VectorContainer particle_container{};
   for (unsigned i = 0; i < size; i++) {
@@ -53,4 +57,17 @@ std::vector<Particle> TestUtils::getParticleVector(LinkedCellsContainer &contain
 
   container.forEach(saveParticles);
   return particles;
-}
\ No newline at end of file
+}
+void TestUtils::expectEqualForces(LinkedCellsContainer &expected, LinkedCellsContainer &actual) {
+  auto expectedParticles = getParticleVector(expected);
+  auto actualParticles = getParticleVector(actual);
+
+  ASSERT_EQ(expectedParticles.size(), actualParticles.size());
+  for (size_t i = 0; i < expectedParticles.size(); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double expectedForce = expectedParticles[i].getF()[j];
+      EXPECT_NEAR(expectedForce, actualParticles[i].getF()[j], 1e-8 + 1e-12 * std::abs(expectedForce))
+          << "Particle " << i;
+    }
+  }
+}
@@ -25,4 +25,12 @@ void applyForceCalc(LinkedCellsContainer &container);
 
 std::vector<Particle> getParticleVector(LinkedCellsContainer &container);
 
+/**
+ * Compares the forces of the particles of two containers. The forces are summed up in a different order, so they are
+ * compared relative to their magnitude.
+ * @param expected The container with the reference forces
+ * @param actual The container with the forces to check
+ */
+void expectEqualForces(LinkedCellsContainer &expected, LinkedCellsContainer &actual);
+
 }  // end namespace TestUtils
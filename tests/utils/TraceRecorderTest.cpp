@@ -0,0 +1,87 @@
+#include <fstream>
+#include <sstream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "dataStructures/parallelizedLinkedCell/LinkedCellsContainerColouringSingle.h"
+#include "gtest/gtest.h"
+#include "utils/PhaseTimers.h"
+#include "utils/TraceRecorder.h"
+
+namespace {
+/**
+ * Writes the trace and reads it back
+ * @return The content of the trace file
+ */
+std::string readTrace() {
+  TraceRecorder::writeJson("traceRecorderTest.json");
+  std::ifstream file{"traceRecorderTest.json"};
+  std::stringstream json;
+  json << file.rdbuf();
+  file.close();
+  std::remove("traceRecorderTest.json");
+  return json.str();
+}
+}  // namespace
+
+/**
+ * Make sure only the sampled iterations are recorded and the phase timers stay disabled
+ */
+TEST(TraceRecorder, RecordsSampledIterations) {
+  TraceRecorder::enable(3);
+  for (std::uint64_t iteration = 0; iteration < 7; ++iteration) {
+    TraceRecorder::beginIteration(iteration);
+    EXPECT_EQ(TraceRecorder::isRecording(), iteration % 3 == 0) << "Iteration " << iteration;
+    ScopedPhaseTimer timer{Phase::Thermostat};
+  }
+  TraceRecorder::disable();
+  EXPECT_FALSE(TraceRecorder::isRecording());
+  EXPECT_FALSE(PhaseTimers::isEnabled());
+
+  EXPECT_EQ(TraceRecorder::getEventCount(), 3);
+  auto json = readTrace();
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\": \"Thermostat\", \"cat\": \"phase\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0"),
+            std::string::npos);
+  for (auto iteration : {"0", "3", "6"}) {
+    EXPECT_NE(json.find("\"args\": {\"iteration\": " + std::string(iteration) + "}"), std::string::npos) << iteration;
+  }
+  EXPECT_EQ(json.find("\"args\": {\"iteration\": 1}"), std::string::npos);
+
+  EXPECT_THROW(TraceRecorder::enable(0), std::invalid_argument);
+  EXPECT_THROW(TraceRecorder::writeJson("missingDirectory/trace.json"), std::runtime_error);
+}
+
+#ifdef _OPENMP
+/**
+ * Make sure every thread records its own event for each colour pass
+ */
+TEST(TraceRecorder, RecordsColourPassesPerThread) {
+  std::array<double, 3> left{0., 0., 0.};
+  std::array<double, 3> right{6., 6., 6.};
+  LinkedCellsContainerColouringSingle container{1.0, left, right};
+  container.emplace_back({1.5, 1.5, 1.5}, {}, 1., 0);
+  container.emplace_back({2.5, 1.5, 1.5}, {}, 1., 0);
+  std::function<void(Particle &, Particle &)> noForce{[](Particle &, Particle &) {}};
+
+  TraceRecorder::enable(1);
+  TraceRecorder::beginIteration(0);
+  container.forEachPair(noForce);
+  TraceRecorder::disable();
+
+  auto json = readTrace();
+  for (auto name : {"Rebinning", "Boundaries", "Pair loop", "Colour pass 0", "Colour pass 17"}) {
+    EXPECT_NE(json.find("\"name\": \"" + std::string(name) + "\""), std::string::npos) << name;
+  }
+  EXPECT_EQ(json.find("\"name\": \"Colour pass 18\""), std::string::npos);
+
+  // Each thread of the 18 parallel regions records one event, besides the phases of the master thread
+  int threadCount = 0;
+#pragma omp parallel default(none) shared(threadCount)
+#pragma omp single
+  threadCount = omp_get_num_threads();
+  EXPECT_EQ(TraceRecorder::getEventCount(), 3 + 18 * threadCount);
+  EXPECT_NE(json.find("\"args\": {\"name\": \"Thread 0\"}"), std::string::npos);
+}
+#endif